@@ -0,0 +1,209 @@
+/*
+ * ADT/BumpAllocator.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ADT {
+    // Hands out memory from large slabs that are only freed when the allocator
+    // is destroyed. Used for storage that lives as long as the AST, such as
+    // the child lists of AST nodes.
+
+    struct BumpAllocator {
+    protected:
+        constexpr static auto SlabSize = size_t(64) * 1024;
+
+        std::vector<void *> SlabList;
+
+        uint8_t *Current = nullptr;
+        uint8_t *End = nullptr;
+
+        [[nodiscard]]
+        auto allocateSlab(const size_t Size) noexcept -> uint8_t * {
+            const auto Slab = static_cast<uint8_t *>(std::malloc(Size));
+            if (Slab == nullptr) {
+                std::abort();
+            }
+
+            this->SlabList.emplace_back(Slab);
+            return Slab;
+        }
+
+        [[nodiscard]] static auto threadOverride() noexcept
+            -> BumpAllocator *&
+        {
+            thread_local auto Result = static_cast<BumpAllocator *>(nullptr);
+            return Result;
+        }
+    public:
+        // Makes an allocator the current thread's allocator until the scope
+        // ends, so whoever owns it decides how long the memory lives. Used
+        // for worker threads, whose allocations outlive the thread.
+
+        struct ThreadScope {
+        protected:
+            BumpAllocator *Previous;
+        public:
+            explicit ThreadScope(BumpAllocator &Allocator) noexcept
+            : Previous(std::exchange(threadOverride(), &Allocator)) {}
+
+            ThreadScope(const ThreadScope &) = delete;
+            auto operator=(const ThreadScope &) = delete;
+
+            ~ThreadScope() noexcept {
+                threadOverride() = this->Previous;
+            }
+        };
+
+        explicit BumpAllocator() noexcept = default;
+
+        BumpAllocator(const BumpAllocator &) = delete;
+        auto operator=(const BumpAllocator &) = delete;
+
+        ~BumpAllocator() noexcept {
+            for (const auto Slab : this->SlabList) {
+                std::free(Slab);
+            }
+        }
+
+        // Each thread gets its own allocator, so no locking is needed when
+        // parsing in parallel. Unless a ThreadScope gave the thread another
+        // one, the allocator is created on first use and intentionally
+        // leaked, as what was allocated may outlive the thread.
+
+        [[nodiscard]] static auto threadLocal() noexcept -> BumpAllocator & {
+            if (const auto Override = threadOverride()) {
+                return *Override;
+            }
+
+            thread_local auto &Result = *new BumpAllocator();
+            return Result;
+        }
+
+        [[nodiscard]]
+        auto allocate(const size_t Size, const size_t Align) noexcept
+            -> void *
+        {
+            const auto Addr = reinterpret_cast<uintptr_t>(this->Current);
+            const auto Aligned = (Addr + Align - 1) & ~(Align - 1);
+
+            if (this->Current != nullptr &&
+                Aligned + Size <= reinterpret_cast<uintptr_t>(this->End))
+            {
+                this->Current = reinterpret_cast<uint8_t *>(Aligned + Size);
+                return reinterpret_cast<void *>(Aligned);
+            }
+
+            // Oversized requests get a slab of their own, so the current slab
+            // can keep being used.
+
+            if (Size + Align > SlabSize / 4) {
+                const auto Slab = this->allocateSlab(Size + Align);
+                const auto SlabAddr = reinterpret_cast<uintptr_t>(Slab);
+
+                return reinterpret_cast<void *>(
+                    (SlabAddr + Align - 1) & ~(Align - 1));
+            }
+
+            this->Current = this->allocateSlab(SlabSize);
+            this->End = this->Current + SlabSize;
+
+            return this->allocate(Size, Align);
+        }
+
+        // Constructs a T in storage owned by this allocator.
+        template <typename T, typename... ArgTypes>
+        [[nodiscard]] auto create(ArgTypes &&...Args) noexcept -> T & {
+            static_assert(std::is_trivially_destructible_v<T>,
+                          "Destructors are never run for arena storage");
+
+            const auto Ptr = this->allocate(sizeof(T), alignof(T));
+            return *new (Ptr) T(std::forward<ArgTypes>(Args)...);
+        }
+
+        // Copy List into storage owned by this allocator.
+
+        template <typename T>
+        [[nodiscard]] auto copy(const std::span<const T> List) noexcept
+            -> std::span<T>
+        {
+            static_assert(std::is_trivially_destructible_v<T>,
+                          "Destructors are never run for arena storage");
+
+            if (List.empty()) {
+                return std::span<T>();
+            }
+
+            const auto Result =
+                static_cast<T *>(
+                    this->allocate(sizeof(T) * List.size(), alignof(T)));
+
+            std::uninitialized_copy(List.begin(), List.end(), Result);
+            return std::span(Result, List.size());
+        }
+
+        template <typename T>
+        [[nodiscard]] auto copy(const std::span<T> List) noexcept
+            -> std::span<T>
+        {
+            return this->copy(std::span<const T>(List));
+        }
+
+        template <typename T>
+        [[nodiscard]] auto copy(const std::vector<T> &List) noexcept
+            -> std::span<T>
+        {
+            return this->copy(std::span<const T>(List));
+        }
+
+        [[nodiscard]]
+        auto copy(const std::string_view String) noexcept -> std::string_view {
+            if (String.empty()) {
+                return std::string_view();
+            }
+
+            const auto Result =
+                static_cast<char *>(this->allocate(String.size(), 1));
+
+            std::memcpy(Result, String.data(), String.size());
+            return std::string_view(Result, String.size());
+        }
+    };
+
+    // Constructs a T in the current thread's allocator.
+    template <typename T, typename... ArgTypes>
+    [[nodiscard]] inline auto ArenaNew(ArgTypes &&...Args) noexcept -> T & {
+        return BumpAllocator::threadLocal().create<T>(
+            std::forward<ArgTypes>(Args)...);
+    }
+
+    // Copy List into the current thread's allocator.
+
+    template <typename T>
+    [[nodiscard]] inline auto ArenaCopy(const std::span<T> List) noexcept {
+        return BumpAllocator::threadLocal().copy(List);
+    }
+
+    template <typename T>
+    [[nodiscard]]
+    inline auto ArenaCopy(const std::vector<T> &List) noexcept {
+        return BumpAllocator::threadLocal().copy(List);
+    }
+
+    [[nodiscard]]
+    inline auto ArenaCopy(const std::string_view String) noexcept {
+        return BumpAllocator::threadLocal().copy(String);
+    }
+}
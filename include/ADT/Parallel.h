@@ -0,0 +1,59 @@
+/*
+ * ADT/Parallel.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ADT {
+    // Calls Callback with every index below Count, spread over one thread per
+    // core, the calling thread included. A thread takes the next index that's
+    // left whenever it finishes one, so a few slow indices don't hold up the
+    // others. Returns once every call has returned.
+
+    template <typename CallbackType>
+    void
+    ForEachInParallel(const size_t Count,
+                      const CallbackType &Callback) noexcept
+    {
+        const auto ThreadCount =
+            std::min(static_cast<size_t>(std::thread::hardware_concurrency()),
+                     Count);
+
+        if (ThreadCount < 2) {
+            for (auto I = size_t(); I != Count; I++) {
+                Callback(I);
+            }
+
+            return;
+        }
+
+        auto NextIndex = std::atomic<size_t>();
+        const auto Worker = [&]() noexcept {
+            for (auto I = NextIndex.fetch_add(1, std::memory_order_relaxed);
+                 I < Count;
+                 I = NextIndex.fetch_add(1, std::memory_order_relaxed))
+            {
+                Callback(I);
+            }
+        };
+
+        auto ThreadList = std::vector<std::thread>();
+        ThreadList.reserve(ThreadCount - 1);
+
+        for (auto I = size_t(1); I != ThreadCount; I++) {
+            ThreadList.emplace_back(Worker);
+        }
+
+        Worker();
+        for (auto &Thread : ThreadList) {
+            Thread.join();
+        }
+    }
+}
@@ -7,6 +7,7 @@
 
 #include <cassert>
 #include <concepts>
+#include <cstdint>
 
 #include "Basic/Macros.h"
 
@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "Expr.h"
 
 namespace AST {
@@ -15,24 +17,22 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ArraySubscriptExpr;
     protected:
-        SourceLocation BracketLoc;
-
         Expr *Base;
-        std::vector<Stmt *> DetailList;
+        std::span<Stmt *> DetailList;
     public:
         constexpr explicit
         ArraySubscriptExpr(const SourceLocation BracketLoc,
                            Expr *const Base,
                            const std::span<Stmt *> DetailList) noexcept
-        : Expr(ObjKind), BracketLoc(BracketLoc), Base(Base),
-          DetailList(DetailList.begin(), DetailList.end()) {}
+        : Expr(ObjKind, BracketLoc), Base(Base),
+          DetailList(DetailList) {}
 
-        constexpr explicit
+        explicit
         ArraySubscriptExpr(const SourceLocation BracketLoc,
                            Expr *const Base,
                            std::vector<Stmt *> &&DetailList) noexcept
-        : Expr(ObjKind), BracketLoc(BracketLoc), Base(Base),
-          DetailList(std::move(DetailList)) {}
+        : Expr(ObjKind, BracketLoc), Base(Base),
+          DetailList(ADT::ArenaCopy(DetailList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -45,12 +45,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getBracketLoc() const noexcept {
-            return this->BracketLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getBracketLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getBase() const noexcept {
@@ -13,7 +13,6 @@ namespace AST {
         constexpr static auto ObjKind = NodeKind::BinaryOperation;
     protected:
         Parse::BinaryOperator Operator;
-        SourceLocation Loc;
 
         Expr *Lhs;
         Expr *Rhs;
@@ -23,7 +22,7 @@ namespace AST {
                         const SourceLocation Loc,
                         Expr &Lhs,
                         Expr &Rhs) noexcept
-        : Expr(ObjKind), Operator(Operator), Loc(Loc), Lhs(&Lhs), Rhs(&Rhs) {}
+        : Expr(ObjKind, Loc), Operator(Operator), Lhs(&Lhs), Rhs(&Rhs) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -35,11 +34,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getOperator() const noexcept {
             return this->Operator;
         }
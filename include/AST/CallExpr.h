@@ -7,6 +7,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "Expr.h"
 #include "Qualifiers.h"
 
@@ -27,26 +29,25 @@ namespace AST {
     protected:
         Expr *CalleeExpr;
 
-        SourceLocation ParenLoc;
         Qualifiers Quals;
 
-        std::vector<Argument> ArgList;
+        std::span<Argument> ArgList;
     public:
         explicit
         CallExpr(Expr *const Callee,
                  const SourceLocation ParenLoc,
                  const Qualifiers &Quals,
                  const std::span<Argument> ArgList) noexcept
-        : Expr(ObjKind), CalleeExpr(Callee), ParenLoc(ParenLoc), Quals(Quals),
-          ArgList(ArgList.begin(), ArgList.end()) {}
+        : Expr(ObjKind, ParenLoc), CalleeExpr(Callee), Quals(Quals),
+          ArgList(ArgList) {}
 
         explicit
         CallExpr(Expr *const Callee,
                  const SourceLocation ParenLoc,
                  const Qualifiers &Quals,
                  std::vector<Argument> &&ArgList) noexcept
-        : Expr(ObjKind), CalleeExpr(Callee), ParenLoc(ParenLoc), Quals(Quals),
-          ArgList(std::move(ArgList)) {}
+        : Expr(ObjKind, ParenLoc), CalleeExpr(Callee), Quals(Quals),
+          ArgList(ADT::ArenaCopy(ArgList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -63,12 +64,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getParenLoc() const noexcept {
-            return this->ParenLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getParenLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getArgumentList() const noexcept {
@@ -79,6 +75,14 @@ namespace AST {
             return this->ArgList;
         }
 
+        [[nodiscard]] auto &getQualifiers() const noexcept {
+            return this->Quals;
+        }
+
+        [[nodiscard]] auto &getQualifiersRef() noexcept {
+            return this->Quals;
+        }
+
         constexpr auto setCallee(Expr *const Callee) noexcept -> decltype(*this)
         {
             this->CalleeExpr = Callee;
@@ -88,7 +92,7 @@ namespace AST {
         constexpr auto setParenLoc(const SourceLocation ParenLoc) noexcept
             -> decltype(*this)
         {
-            this->ParenLoc = ParenLoc;
+            this->Loc = ParenLoc;
             return *this;
         }
     };
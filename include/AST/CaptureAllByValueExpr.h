@@ -13,18 +13,17 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::CaptureAllByValueExpr;
     protected:
-        SourceLocation Loc;
         Qualifiers Quals;
     public:
         explicit
         CaptureAllByValueExpr(const SourceLocation Loc,
                               const Qualifiers &Quals) noexcept
-        : Expr(ObjKind), Loc(Loc), Quals(Quals) {}
+        : Expr(ObjKind, Loc), Quals(Quals) {}
 
         explicit
         CaptureAllByValueExpr(const SourceLocation Loc,
                               Qualifiers &&Quals) noexcept
-        : Expr(ObjKind), Loc(Loc), Quals(std::move(Quals)) {}
+        : Expr(ObjKind, Loc), Quals(std::move(Quals)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -36,11 +35,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] auto &getQualifiers() const noexcept {
             return this->Quals;
         }
@@ -11,8 +11,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::CastExpr;
     protected:
-        SourceLocation AsLoc;
-
         Expr *Operand;
         Expr *TypeExpr;
     public:
@@ -20,7 +18,7 @@ namespace AST {
         CastExpr(const SourceLocation AsLoc,
                  Expr &Operand,
                  Expr &TypeExpr) noexcept
-        : Expr(ObjKind), AsLoc(AsLoc), Operand(&Operand), TypeExpr(&TypeExpr) {}
+        : Expr(ObjKind, AsLoc), Operand(&Operand), TypeExpr(&TypeExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -32,11 +30,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->AsLoc;
-        }
-
         [[nodiscard]] constexpr auto getOperand() const noexcept {
             return this->Operand;
         }
@@ -48,7 +41,7 @@ namespace AST {
         constexpr auto setAsLoc(const SourceLocation AsLoc) noexcept
             -> decltype(*this)
         {
-            this->AsLoc = AsLoc;
+            this->Loc = AsLoc;
             return *this;
         }
 
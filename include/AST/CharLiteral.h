@@ -12,12 +12,11 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::CharLiteral;
     protected:
-        SourceLocation Loc;
         char Value;
     public:
         constexpr explicit
         CharLiteral(const SourceLocation Loc, const char Value) noexcept
-        : Expr(ObjKind), Loc(Loc), Value(Value) {}
+        : Expr(ObjKind, Loc), Value(Value) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -29,11 +28,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getValue() const noexcept {
             return this->Value;
         }
@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "Stmt.h"
 
 namespace AST {
@@ -15,15 +17,15 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::CommaSepStmtList;
     protected:
-        std::vector<Stmt *> StmtList;
+        std::span<Stmt *> StmtList;
     public:
         constexpr explicit
         CommaSepStmtList(const std::span<Stmt *> StmtList) noexcept
-        : Stmt(ObjKind), StmtList(StmtList.begin(), StmtList.end()) {}
+        : Stmt(ObjKind), StmtList(StmtList) {}
 
-        constexpr explicit
+        explicit
         CommaSepStmtList(std::vector<Stmt *> &&StmtList) noexcept
-        : Stmt(ObjKind), StmtList(std::move(StmtList)) {}
+        : Stmt(ObjKind), StmtList(ADT::ArenaCopy(StmtList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
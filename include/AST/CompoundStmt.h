@@ -7,6 +7,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "Source/SourceLocation.h"
 #include "Stmt.h"
 
@@ -15,19 +17,17 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::CompoundStmt;
     protected:
-        SourceLocation BraceLoc;
-        std::vector<Stmt *> StmtList;
+        std::span<Stmt *> StmtList;
     public:
         constexpr explicit
         CompoundStmt(const SourceLocation BraceLoc,
                      const std::span<Stmt *> StmtList) noexcept
-        : Stmt(ObjKind), BraceLoc(BraceLoc),
-          StmtList(StmtList.begin(), StmtList.end()) {}
+        : Stmt(ObjKind, BraceLoc), StmtList(StmtList) {}
 
-        constexpr explicit
+        explicit
         CompoundStmt(const SourceLocation BraceLoc,
                      std::vector<Stmt *> &&StmtList) noexcept
-        : Stmt(ObjKind), BraceLoc(BraceLoc), StmtList(std::move(StmtList)) {}
+        : Stmt(ObjKind, BraceLoc), StmtList(ADT::ArenaCopy(StmtList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -40,7 +40,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getBraceLoc() const noexcept {
-            return this->BraceLoc;
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getStmtList() const noexcept {
@@ -54,7 +54,7 @@ namespace AST {
         constexpr auto setBraceLoc(const SourceLocation BraceLoc) noexcept
             -> decltype(*this)
         {
-            this->BraceLoc = BraceLoc;
+            this->Loc = BraceLoc;
             return *this;
         }
     };
@@ -13,12 +13,15 @@ namespace AST {
         constexpr static auto ObjKind = NodeKind::DeclRefExpr;
     protected:
         std::string Name;
-        SourceLocation NameLoc;
+
+        // The declaration Name refers to, once names are resolved. Either an
+        // LvalueNamedDecl, or the binding declaration that declares Name.
+        Stmt *Decl = nullptr;
     public:
         constexpr explicit
         DeclRefExpr(const std::string_view Name,
                     const SourceLocation NameLoc) noexcept
-        : Expr(ObjKind), Name(Name), NameLoc(NameLoc) {}
+        : Expr(ObjKind, NameLoc), Name(Name) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -31,12 +34,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getNameLoc() const noexcept {
-            return this->NameLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getNameLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getName() const noexcept
@@ -45,6 +43,10 @@ namespace AST {
             return this->Name;
         }
 
+        [[nodiscard]] constexpr auto getDecl() const noexcept {
+            return this->Decl;
+        }
+
         constexpr auto setName(const std::string_view Name) noexcept
             -> decltype(*this)
         {
@@ -60,7 +62,12 @@ namespace AST {
         constexpr auto setNameLoc(const SourceLocation NameLoc) noexcept
             -> decltype(*this)
         {
-            this->NameLoc = NameLoc;
+            this->Loc = NameLoc;
+            return *this;
+        }
+
+        constexpr auto setDecl(Stmt *const Decl) noexcept -> decltype(*this) {
+            this->Decl = Decl;
             return *this;
         }
     };
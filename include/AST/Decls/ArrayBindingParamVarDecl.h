@@ -23,7 +23,8 @@ namespace AST {
                                  const Qualifiers &Quals,
                                  std::vector<ArrayBindingItem *> &&ItemList,
                                  Expr *const InitExpr) noexcept
-        : ArrayBindingVarDecl(ObjKind, Loc, Quals, ItemList, InitExpr) {}
+        : ArrayBindingVarDecl(ObjKind, Loc, Quals, std::move(ItemList),
+                              InitExpr) {}
 
         explicit
         ArrayBindingParamVarDecl(const SourceLocation Loc,
@@ -37,7 +38,8 @@ namespace AST {
                                  Qualifiers &&Quals,
                                  std::vector<ArrayBindingItem *> &&ItemList,
                                  Expr *const InitExpr) noexcept
-        : ArrayBindingVarDecl(ObjKind, Loc, Quals, ItemList, InitExpr) {}
+        : ArrayBindingVarDecl(ObjKind, Loc, Quals, std::move(ItemList),
+                              InitExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -10,6 +10,8 @@
 #include <string_view>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/Expr.h"
 #include "AST/Qualifiers.h"
 
@@ -135,7 +137,7 @@ namespace AST {
     public:
         constexpr static auto ObjKind = ArrayBindingItemKind::Array;
     protected:
-        std::vector<ArrayBindingItem *> ItemList;
+        std::span<ArrayBindingItem *> ItemList;
         SourceLocation ItemLoc;
     public:
         explicit
@@ -144,7 +146,7 @@ namespace AST {
                               const std::span<ArrayBindingItem *> ItemList,
                               const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          ItemList(ItemList.begin(), ItemList.end()), ItemLoc(ItemLoc) {}
+          ItemList(ItemList), ItemLoc(ItemLoc) {}
 
         explicit
         ArrayBindingItemArray(const Qualifiers &Quals,
@@ -152,7 +154,7 @@ namespace AST {
                               std::vector<ArrayBindingItem *> &&ItemList,
                               const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          ItemList(std::move(ItemList)), ItemLoc(ItemLoc) {}
+          ItemList(ADT::ArenaCopy(ItemList)), ItemLoc(ItemLoc) {}
 
         explicit
         ArrayBindingItemArray(Qualifiers &&Quals,
@@ -160,7 +162,7 @@ namespace AST {
                               const std::span<ArrayBindingItem *> ItemList,
                               const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          ItemList(ItemList.begin(), ItemList.end()), ItemLoc(ItemLoc) {}
+          ItemList(ItemList), ItemLoc(ItemLoc) {}
 
         explicit
         ArrayBindingItemArray(Qualifiers &&Quals,
@@ -168,7 +170,7 @@ namespace AST {
                               std::vector<ArrayBindingItem *> &&ItemList,
                               const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          ItemList(std::move(ItemList)), ItemLoc(ItemLoc) {}
+          ItemList(ADT::ArenaCopy(ItemList)), ItemLoc(ItemLoc) {}
 
         [[nodiscard]] constexpr
         static auto IsOfKind(const ArrayBindingItem &Item) noexcept {
@@ -205,7 +207,7 @@ namespace AST {
     public:
         constexpr static auto ObjKind = ArrayBindingItemKind::Object;
     protected:
-        std::vector<ObjectBindingField *> FieldList;
+        std::span<ObjectBindingField *> FieldList;
         SourceLocation ItemLoc;
     public:
         explicit
@@ -214,7 +216,7 @@ namespace AST {
                                const std::span<ObjectBindingField *> FieldList,
                                const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          FieldList(FieldList.begin(), FieldList.end()), ItemLoc(ItemLoc) {}
+          FieldList(FieldList), ItemLoc(ItemLoc) {}
 
         explicit
         ArrayBindingItemObject(const Qualifiers &Quals,
@@ -222,7 +224,7 @@ namespace AST {
                                std::vector<ObjectBindingField *> &&FieldList,
                                const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          FieldList(std::move(FieldList)), ItemLoc(ItemLoc) {}
+          FieldList(ADT::ArenaCopy(FieldList)), ItemLoc(ItemLoc) {}
 
         explicit
         ArrayBindingItemObject(Qualifiers &&Quals,
@@ -230,7 +232,7 @@ namespace AST {
                                const std::span<ObjectBindingField *> FieldList,
                                const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          FieldList(FieldList.begin(), FieldList.end()), ItemLoc(ItemLoc) {}
+          FieldList(FieldList), ItemLoc(ItemLoc) {}
 
         explicit
         ArrayBindingItemObject(Qualifiers &&Quals,
@@ -238,7 +240,7 @@ namespace AST {
                                std::vector<ObjectBindingField *> &&FieldList,
                                const SourceLocation ItemLoc) noexcept
         : ArrayBindingItem(ObjKind, Quals, Index),
-          FieldList(std::move(FieldList)), ItemLoc(ItemLoc) {}
+          FieldList(ADT::ArenaCopy(FieldList)), ItemLoc(ItemLoc) {}
 
         [[nodiscard]] constexpr
         static auto IsOfKind(const ArrayBindingItem &Item) noexcept {
@@ -325,16 +327,22 @@ namespace AST {
             this->SpreadLoc = SpreadLoc;
             return *this;
         }
+
+        constexpr auto setNameLoc(const SourceLocation NameLoc) noexcept
+            -> decltype(*this)
+        {
+            this->NameLoc = NameLoc;
+            return *this;
+        }
     };
 
     struct ArrayBindingVarDecl : public Stmt {
     public:
         constexpr static auto ObjKind = NodeKind::ArrayBindingVarDecl;
     protected:
-        SourceLocation Loc;
         Qualifiers Quals;
 
-        std::vector<ArrayBindingItem *> ItemList;
+        std::span<ArrayBindingItem *> ItemList;
         Expr *InitExpr;
 
         explicit
@@ -343,8 +351,8 @@ namespace AST {
                             const Qualifiers &Quals,
                             const std::span<ArrayBindingItem *> ItemList,
                             Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(Quals),
-          ItemList(ItemList.begin(), ItemList.end()), InitExpr(InitExpr) {}
+        : Stmt(NodeKind, Loc), Quals(Quals),
+          ItemList(ItemList), InitExpr(InitExpr) {}
 
         explicit
         ArrayBindingVarDecl(const NodeKind NodeKind,
@@ -352,7 +360,8 @@ namespace AST {
                             const Qualifiers &Quals,
                             std::vector<ArrayBindingItem *> &&ItemList,
                             Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(Quals), ItemList(std::move(ItemList)),
+        : Stmt(NodeKind, Loc), Quals(Quals),
+          ItemList(ADT::ArenaCopy(ItemList)),
           InitExpr(InitExpr) {}
 
         explicit
@@ -361,8 +370,8 @@ namespace AST {
                             Qualifiers &&Quals,
                             const std::span<ArrayBindingItem *> &ItemList,
                             Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(Quals),
-          ItemList(ItemList.begin(), ItemList.end()), InitExpr(InitExpr) {}
+        : Stmt(NodeKind, Loc), Quals(Quals),
+          ItemList(ItemList), InitExpr(InitExpr) {}
 
         explicit
         ArrayBindingVarDecl(const NodeKind NodeKind,
@@ -370,7 +379,8 @@ namespace AST {
                             Qualifiers &&Quals,
                             std::vector<ArrayBindingItem *> &&ItemList,
                             Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(Quals), ItemList(std::move(ItemList)),
+        : Stmt(NodeKind, Loc), Quals(Quals),
+          ItemList(ADT::ArenaCopy(ItemList)),
           InitExpr(InitExpr) {}
     public:
         explicit
@@ -385,7 +395,8 @@ namespace AST {
                             const Qualifiers &Quals,
                             std::vector<ArrayBindingItem *> &&ItemList,
                             Expr *const InitExpr) noexcept
-        : ArrayBindingVarDecl(ObjKind, Loc, Quals, ItemList, InitExpr) {}
+        : ArrayBindingVarDecl(ObjKind, Loc, Quals, std::move(ItemList),
+                              InitExpr) {}
 
         explicit
         ArrayBindingVarDecl(const SourceLocation Loc,
@@ -399,7 +410,8 @@ namespace AST {
                             Qualifiers &&Quals,
                             std::vector<ArrayBindingItem *> &&ItemList,
                             Expr *const InitExpr) noexcept
-        : ArrayBindingVarDecl(ObjKind, Loc, Quals, ItemList, InitExpr) {}
+        : ArrayBindingVarDecl(ObjKind, Loc, Quals, std::move(ItemList),
+                              InitExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
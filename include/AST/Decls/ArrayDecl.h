@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/Expr.h"
 
 namespace AST {
@@ -15,20 +17,18 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ArrayDecl;
     protected:
-        SourceLocation LeftBracketLoc;
-        std::vector<Stmt *> ElementList;
+        std::span<Stmt *> ElementList;
     public:
         constexpr explicit
         ArrayDecl(const SourceLocation LeftBracketLoc,
                   const std::span<Stmt *> ElementList) noexcept
-        : Expr(ObjKind), LeftBracketLoc(LeftBracketLoc),
-          ElementList(ElementList.begin(), ElementList.end()) {}
+        : Expr(ObjKind, LeftBracketLoc), ElementList(ElementList) {}
 
-        constexpr explicit
+        explicit
         ArrayDecl(const SourceLocation LeftBracketLoc,
                   std::vector<Stmt *> &&ElementList) noexcept
-        : Expr(ObjKind), LeftBracketLoc(LeftBracketLoc),
-          ElementList(std::move(ElementList)) {}
+        : Expr(ObjKind, LeftBracketLoc),
+          ElementList(ADT::ArenaCopy(ElementList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -41,12 +41,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getLeftBracketLoc() const noexcept {
-            return this->LeftBracketLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getLeftBracketLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getElementList() const noexcept {
@@ -60,7 +55,7 @@ namespace AST {
         constexpr auto setLeftBracketLoc(const SourceLocation Loc) noexcept
             -> decltype(*this)
         {
-            this->LeftBracketLoc = Loc;
+            this->Loc = Loc;
             return *this;
         }
     };
@@ -4,6 +4,7 @@
  */
 
 #pragma once
+#include "ADT/BumpAllocator.h"
 #include "FunctionDecl.h"
 
 namespace AST {
@@ -11,7 +12,7 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ClosureDecl;
     protected:
-        std::vector<Stmt *> CaptureList;
+        std::span<Stmt *> CaptureList;
     public:
         explicit
         ClosureDecl(const SourceLocation Loc,
@@ -21,7 +22,7 @@ namespace AST {
                     Expr *const ReturnType,
                     Stmt *const Body) noexcept
         : FunctionDecl(ObjKind, Loc, Quals, ParamList, ReturnType, Body),
-          CaptureList(CaptureList.begin(), CaptureList.end()) {}
+          CaptureList(CaptureList) {}
 
         explicit
         ClosureDecl(const SourceLocation Loc,
@@ -31,7 +32,7 @@ namespace AST {
                     Expr *const ReturnType,
                     Stmt *const Body) noexcept
         : FunctionDecl(ObjKind, Loc, Quals, ParamList, ReturnType, Body),
-          CaptureList(std::move(CaptureList)) {}
+          CaptureList(ADT::ArenaCopy(CaptureList)) {}
 
         explicit
         ClosureDecl(const SourceLocation Loc,
@@ -42,7 +43,7 @@ namespace AST {
                     Stmt *const Body) noexcept
         : FunctionDecl(ObjKind, Loc, Quals, std::move(ParamList), ReturnType,
                        Body),
-          CaptureList(CaptureList.begin(), CaptureList.end()) {}
+          CaptureList(CaptureList) {}
 
         explicit
         ClosureDecl(const SourceLocation Loc,
@@ -53,7 +54,7 @@ namespace AST {
                     Stmt *const Body) noexcept
         : FunctionDecl(ObjKind, Loc, Quals, std::move(ParamList), ReturnType,
                        Body),
-          CaptureList(std::move(CaptureList)) {}
+          CaptureList(ADT::ArenaCopy(CaptureList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
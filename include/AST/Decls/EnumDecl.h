@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/Expr.h"
 
 namespace AST {
@@ -15,19 +17,17 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::EnumDecl;
     protected:
-        SourceLocation Loc;
-        std::vector<Stmt *> MemberList;
+        std::span<Stmt *> MemberList;
     public:
         constexpr explicit
         EnumDecl(const SourceLocation Loc,
                  const std::span<Stmt *> MemberList) noexcept
-        : Expr(ObjKind), Loc(Loc),
-          MemberList(MemberList.begin(), MemberList.end()) {}
+        : Expr(ObjKind, Loc), MemberList(MemberList) {}
 
-        constexpr explicit
+        explicit
         EnumDecl(const SourceLocation Loc,
                  std::vector<Stmt *> &&MemberList) noexcept
-        : Expr(ObjKind), Loc(Loc), MemberList(std::move(MemberList)) {}
+        : Expr(ObjKind, Loc), MemberList(ADT::ArenaCopy(MemberList)) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -39,11 +39,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getMemberList() const noexcept {
             return std::span(this->MemberList);
         }
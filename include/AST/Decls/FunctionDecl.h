@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/Expr.h"
 #include "AST/Qualifiers.h"
 
@@ -16,14 +18,18 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::FunctionDecl;
     protected:
-        std::vector<Stmt *> ParamList;
+        std::span<Stmt *> ParamList;
 
-        SourceLocation Loc;
         Qualifiers Quals;
 
         Expr *ReturnTypeExpr;
         Stmt *Body;
 
+        // Number of local slots Sema gave out in the function. A function
+        // nested in another one shares its slots, so the outer function's
+        // count includes the inner one's locals.
+        uint32_t SlotCount = 0;
+
         explicit
         FunctionDecl(const NodeKind ObjKind,
                      const SourceLocation Loc,
@@ -31,7 +37,7 @@ namespace AST {
                      std::vector<Stmt *> &&ParamList,
                      Expr *const ReturnTypeExpr,
                      Stmt *const Body) noexcept
-        : Expr(ObjKind), ParamList(std::move(ParamList)), Loc(Loc),
+        : Expr(ObjKind, Loc), ParamList(ADT::ArenaCopy(ParamList)),
           Quals(Quals), ReturnTypeExpr(ReturnTypeExpr), Body(Body) {}
 
         explicit
@@ -41,7 +47,7 @@ namespace AST {
                      std::vector<Stmt *> &&ParamList,
                      Expr *const ReturnTypeExpr,
                      Stmt *const Body) noexcept
-        : Expr(ObjKind), ParamList(std::move(ParamList)), Loc(Loc),
+        : Expr(ObjKind, Loc), ParamList(ADT::ArenaCopy(ParamList)),
           Quals(std::move(Quals)), ReturnTypeExpr(ReturnTypeExpr), Body(Body) {}
 
         explicit
@@ -51,8 +57,8 @@ namespace AST {
                      const std::span<Stmt *> ParamList,
                      Expr *const ReturnTypeExpr,
                      Stmt *const Body) noexcept
-        : Expr(ObjKind), ParamList(ParamList.begin(), ParamList.end()),
-          Loc(Loc), Quals(Quals), ReturnTypeExpr(ReturnTypeExpr), Body(Body) {}
+        : Expr(ObjKind, Loc), ParamList(ParamList), Quals(Quals),
+          ReturnTypeExpr(ReturnTypeExpr), Body(Body) {}
 
         explicit
         FunctionDecl(const NodeKind ObjKind,
@@ -61,8 +67,8 @@ namespace AST {
                      const std::span<Stmt *> ParamDeclList,
                      Expr *const ReturnTypeExpr,
                      Stmt *const Body) noexcept
-        : Expr(ObjKind),
-          ParamList(ParamDeclList.begin(), ParamDeclList.end()), Loc(Loc),
+        : Expr(ObjKind, Loc),
+          ParamList(ParamDeclList),
           Quals(std::move(Quals)), ReturnTypeExpr(ReturnTypeExpr), Body(Body) {}
     public:
         explicit
@@ -71,7 +77,8 @@ namespace AST {
                      std::vector<Stmt *> &&ParamList,
                      Expr *const ReturnTypeExpr,
                      Stmt *const Body) noexcept
-        : FunctionDecl(ObjKind, Loc, Quals, ParamList, ReturnTypeExpr, Body) {}
+        : FunctionDecl(ObjKind, Loc, Quals, std::move(ParamList),
+                       ReturnTypeExpr, Body) {}
 
         explicit
         FunctionDecl(const SourceLocation Loc,
@@ -87,7 +94,8 @@ namespace AST {
                      std::vector<Stmt *> &&ParamList,
                      Expr *const ReturnTypeExpr,
                      Stmt *const Body) noexcept
-        : FunctionDecl(ObjKind, Loc, Quals, ParamList, ReturnTypeExpr, Body) {}
+        : FunctionDecl(ObjKind, Loc, Quals, std::move(ParamList),
+                       ReturnTypeExpr, Body) {}
 
         explicit
         FunctionDecl(const SourceLocation Loc,
@@ -123,9 +131,8 @@ namespace AST {
             return this->Body;
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
+        [[nodiscard]] constexpr auto getSlotCount() const noexcept {
+            return this->SlotCount;
         }
 
         [[nodiscard]] auto &getQualifiers() const noexcept {
@@ -147,5 +154,12 @@ namespace AST {
             this->ReturnTypeExpr = &ReturnTypeExpr;
             return *this;
         }
+
+        constexpr auto setSlotCount(const uint32_t SlotCount) noexcept
+            -> decltype(*this)
+        {
+            this->SlotCount = SlotCount;
+            return *this;
+        }
     };
 }
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include "AST/Expr.h"
 
@@ -12,31 +13,35 @@ namespace AST {
     struct LvalueNamedDecl : public Stmt {
     public:
         constexpr static auto ObjKind = NodeKind::LvalueNamedDecl;
+        constexpr static auto NoSlot = UINT32_MAX;
     protected:
         std::string Name;
-        SourceLocation NameLoc;
 
         Expr *RvalueExpr;
 
+        // Index of the declaration among the locals of its function, given
+        // by Sema. Declarations outside of any function have no slot.
+        uint32_t Slot = NoSlot;
+
         constexpr
         LvalueNamedDecl(const NodeKind ObjKind,
                         const std::string_view Name,
                         const SourceLocation NameLoc,
                         Expr *const RvalueExpr) noexcept
-        : Stmt(ObjKind), Name(Name), NameLoc(NameLoc),
+        : Stmt(ObjKind, NameLoc), Name(Name),
           RvalueExpr(RvalueExpr) {}
     public:
         constexpr
         LvalueNamedDecl(const std::string_view Name,
                         const SourceLocation NameLoc,
                         Expr *const RvalueExpr) noexcept
-        : Stmt(ObjKind), Name(Name), NameLoc(NameLoc), RvalueExpr(RvalueExpr) {}
+        : Stmt(ObjKind, NameLoc), Name(Name), RvalueExpr(RvalueExpr) {}
 
         constexpr
         LvalueNamedDecl(std::string &&Name,
                         const SourceLocation NameLoc,
                         Expr *const RvalueExpr) noexcept
-        : Stmt(ObjKind), Name(Name), NameLoc(NameLoc), RvalueExpr(RvalueExpr) {}
+        : Stmt(ObjKind, NameLoc), Name(Name), RvalueExpr(RvalueExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -54,13 +59,21 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getNameLoc() const noexcept {
-            return this->NameLoc;
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getRvalueExpr() const noexcept {
             return this->RvalueExpr;
         }
 
+        [[nodiscard]] constexpr auto hasSlot() const noexcept {
+            return this->Slot != NoSlot;
+        }
+
+        [[nodiscard]] constexpr auto getSlot() const noexcept {
+            return this->Slot;
+        }
+
         constexpr auto setName(const std::string_view Name) noexcept
             -> decltype(*this)
         {
@@ -76,7 +89,7 @@ namespace AST {
         constexpr auto setNameLoc(const SourceLocation NameLoc) noexcept
             -> decltype(*this)
         {
-            this->NameLoc = NameLoc;
+            this->Loc = NameLoc;
             return *this;
         }
 
@@ -86,5 +99,12 @@ namespace AST {
             this->RvalueExpr = RvalueExpr;
             return *this;
         }
+
+        constexpr auto setSlot(const uint32_t Slot) noexcept
+            -> decltype(*this)
+        {
+            this->Slot = Slot;
+            return *this;
+        }
     };
 }
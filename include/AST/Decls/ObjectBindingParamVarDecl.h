@@ -24,7 +24,8 @@ namespace AST {
                                   const Qualifiers &Quals,
                                   std::vector<ObjectBindingField *> &&ItemList,
                                   Expr *const InitExpr) noexcept
-        : ObjectBindingVarDecl(ObjKind, Loc, Quals, ItemList, InitExpr) {}
+        : ObjectBindingVarDecl(ObjKind, Loc, Quals, std::move(ItemList),
+                               InitExpr) {}
 
         explicit
         ObjectBindingParamVarDecl(
@@ -39,7 +40,8 @@ namespace AST {
                                   Qualifiers &&Quals,
                                   std::vector<ObjectBindingField *> &&ItemList,
                                   Expr *const InitExpr) noexcept
-        : ObjectBindingVarDecl(ObjKind, Loc, Quals, ItemList, InitExpr) {}
+        : ObjectBindingVarDecl(ObjKind, Loc, Quals, std::move(ItemList),
+                               InitExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/Decls/ArrayBindingVarDecl.h"
 
 namespace AST {
@@ -132,7 +134,7 @@ namespace AST {
         constexpr static auto ObjKind = ObjectBindingFieldKind::Array;
     protected:
         Qualifiers Quals;
-        std::vector<ArrayBindingItem *> ItemList;
+        std::span<ArrayBindingItem *> ItemList;
     public:
         explicit
         ObjectBindingFieldArray(
@@ -141,7 +143,7 @@ namespace AST {
             const Qualifiers &Quals,
             const std::span<ArrayBindingItem *> ItemList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc), Quals(Quals),
-          ItemList(ItemList.begin(), ItemList.end()) {}
+          ItemList(ItemList) {}
 
         explicit
         ObjectBindingFieldArray(
@@ -150,7 +152,7 @@ namespace AST {
             const Qualifiers &Quals,
             std::vector<ArrayBindingItem *> &&ItemList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc), Quals(Quals),
-          ItemList(std::move(ItemList)) {}
+          ItemList(ADT::ArenaCopy(ItemList)) {}
 
         explicit
         ObjectBindingFieldArray(
@@ -159,7 +161,7 @@ namespace AST {
             Qualifiers &&Quals,
             const std::span<ArrayBindingItem *> ItemList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc), Quals(Quals),
-          ItemList(ItemList.begin(), ItemList.end()) {}
+          ItemList(ItemList) {}
 
         explicit
         ObjectBindingFieldArray(
@@ -168,7 +170,7 @@ namespace AST {
             Qualifiers &&Quals,
             std::vector<ArrayBindingItem *> &&ItemList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc), Quals(Quals),
-          ItemList(std::move(ItemList)) {}
+          ItemList(ADT::ArenaCopy(ItemList)) {}
 
         [[nodiscard]] constexpr
         static auto IsOfKind(const ObjectBindingField &Field) noexcept {
@@ -202,7 +204,7 @@ namespace AST {
         constexpr static auto ObjKind = ObjectBindingFieldKind::Object;
     protected:
         Qualifiers Quals;
-        std::vector<ObjectBindingField *> FieldList;
+        std::span<ObjectBindingField *> FieldList;
     public:
         explicit
         ObjectBindingFieldObject(
@@ -211,7 +213,7 @@ namespace AST {
             const Qualifiers &Quals,
             const std::span<ObjectBindingField *> FieldList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc), Quals(Quals),
-          FieldList(FieldList.begin(), FieldList.end()) {}
+          FieldList(FieldList) {}
 
         explicit
         ObjectBindingFieldObject(
@@ -220,7 +222,7 @@ namespace AST {
             const Qualifiers &Quals,
             std::vector<ObjectBindingField *> &&FieldList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc), Quals(Quals),
-          FieldList(std::move(FieldList)) {}
+          FieldList(ADT::ArenaCopy(FieldList)) {}
 
         explicit
         ObjectBindingFieldObject(
@@ -230,7 +232,7 @@ namespace AST {
             const std::span<ObjectBindingField *> FieldList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc),
           Quals(std::move(Quals)),
-          FieldList(FieldList.begin(), FieldList.end()) {}
+          FieldList(FieldList) {}
 
         explicit
         ObjectBindingFieldObject(
@@ -239,7 +241,7 @@ namespace AST {
             Qualifiers &&Quals,
             std::vector<ObjectBindingField *> &&FieldList) noexcept
         : ObjectBindingField(ObjKind, Key, KeyLoc),
-          Quals(std::move(Quals)), FieldList(std::move(FieldList)) {}
+          Quals(std::move(Quals)), FieldList(ADT::ArenaCopy(FieldList)) {}
 
         [[nodiscard]] constexpr
         static auto IsOfKind(const ObjectBindingField &Field) noexcept {
@@ -325,10 +327,9 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ObjectBindingVarDecl;
     protected:
-        SourceLocation Loc;
         Qualifiers Quals;
 
-        std::vector<ObjectBindingField *> FieldList;
+        std::span<ObjectBindingField *> FieldList;
         Expr *InitExpr;
 
         explicit
@@ -337,8 +338,8 @@ namespace AST {
                              const Qualifiers &Quals,
                              const std::span<ObjectBindingField *> FieldList,
                              Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(Quals),
-          FieldList(FieldList.begin(), FieldList.end()), InitExpr(InitExpr) {}
+        : Stmt(NodeKind, Loc), Quals(Quals),
+          FieldList(FieldList), InitExpr(InitExpr) {}
 
         explicit
         ObjectBindingVarDecl(const NodeKind NodeKind,
@@ -346,8 +347,8 @@ namespace AST {
                              const Qualifiers &Quals,
                              std::vector<ObjectBindingField *> &&FieldList,
                              Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(Quals),
-          FieldList(std::move(FieldList)), InitExpr(InitExpr) {}
+        : Stmt(NodeKind, Loc), Quals(Quals),
+          FieldList(ADT::ArenaCopy(FieldList)), InitExpr(InitExpr) {}
 
         explicit
         ObjectBindingVarDecl(const NodeKind NodeKind,
@@ -355,8 +356,8 @@ namespace AST {
                              Qualifiers &&Quals,
                              const std::span<ObjectBindingField *> FieldList,
                              Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(std::move(Quals)),
-          FieldList(FieldList.begin(), FieldList.end()), InitExpr(InitExpr) {}
+        : Stmt(NodeKind, Loc), Quals(std::move(Quals)),
+          FieldList(FieldList), InitExpr(InitExpr) {}
 
         explicit
         ObjectBindingVarDecl(const NodeKind NodeKind,
@@ -364,8 +365,8 @@ namespace AST {
                              Qualifiers &&Quals,
                              std::vector<ObjectBindingField *> &&FieldList,
                              Expr *const InitExpr) noexcept
-        : Stmt(NodeKind), Loc(Loc), Quals(std::move(Quals)),
-          FieldList(std::move(FieldList)), InitExpr(InitExpr) {}
+        : Stmt(NodeKind, Loc), Quals(std::move(Quals)),
+          FieldList(ADT::ArenaCopy(FieldList)), InitExpr(InitExpr) {}
     public:
         explicit
         ObjectBindingVarDecl(const SourceLocation Loc,
@@ -379,7 +380,8 @@ namespace AST {
                              const Qualifiers &Quals,
                              std::vector<ObjectBindingField *> &&FieldList,
                              Expr *const InitExpr) noexcept
-        : ObjectBindingVarDecl(ObjKind, Loc, Quals, FieldList, InitExpr) {}
+        : ObjectBindingVarDecl(ObjKind, Loc, Quals, std::move(FieldList),
+                               InitExpr) {}
 
         explicit
         ObjectBindingVarDecl(const SourceLocation Loc,
@@ -393,7 +395,8 @@ namespace AST {
                              Qualifiers &&Quals,
                              std::vector<ObjectBindingField *> &&FieldList,
                              Expr *const InitExpr) noexcept
-        : ObjectBindingVarDecl(ObjKind, Loc, Quals, FieldList, InitExpr) {}
+        : ObjectBindingVarDecl(ObjKind, Loc, Quals, std::move(FieldList),
+                               InitExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -8,6 +8,8 @@
  #include <span>
  #include <vector>
 
+ #include "ADT/BumpAllocator.h"
+
  #include "AST/Expr.h"
 
  namespace AST {
@@ -15,19 +17,17 @@
      public:
          constexpr static auto ObjKind = NodeKind::UnionDecl;
      protected:
-         SourceLocation Loc;
-         std::vector<Stmt *> FieldList;
+         std::span<Stmt *> FieldList;
      public:
          constexpr explicit
          UnionDecl(const SourceLocation Loc,
                    const std::span<Stmt *> FieldList) noexcept
-         : Expr(ObjKind), Loc(Loc),
-           FieldList(FieldList.begin(), FieldList.end()) {}
+         : Expr(ObjKind, Loc), FieldList(FieldList) {}
 
-         constexpr explicit
+         explicit
          UnionDecl(const SourceLocation Loc,
                    std::vector<Stmt *> &&FieldList) noexcept
-         : Expr(ObjKind), Loc(Loc), FieldList(std::move(FieldList)) {}
+         : Expr(ObjKind, Loc), FieldList(ADT::ArenaCopy(FieldList)) {}
 
          [[nodiscard]]
          constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -39,11 +39,6 @@
              return IsOfKind(*Node);
          }
 
-         [[nodiscard]]
-         constexpr SourceLocation getLoc() const noexcept override {
-             return this->Loc;
-         }
-
          [[nodiscard]] constexpr auto getFieldList() const noexcept {
              return std::span(this->FieldList);
          }
@@ -11,12 +11,11 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::DerefExpr;
     protected:
-        SourceLocation Loc;
         Expr *Operand = nullptr;
     public:
         constexpr explicit
         DerefExpr(const SourceLocation Loc, Expr *const Operand) noexcept
-        : Expr(ObjKind), Operand(Operand) {}
+        : Expr(ObjKind, Loc), Operand(Operand) {}
 
         [[nodiscard]] static auto IsOfKind(const Stmt &Stmt) noexcept {
             return Stmt.getKind() == ObjKind;
@@ -30,10 +29,6 @@ namespace AST {
             return this->Operand;
         }
 
-        [[nodiscard]] virtual SourceLocation getLoc() const noexcept override {
-            return Operand->getLoc();
-        }
-
         constexpr auto setOperand(Expr &Operand) noexcept -> decltype(*this) {
             this->Operand = &Operand;
             return *this;
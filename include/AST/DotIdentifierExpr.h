@@ -16,8 +16,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::DotIdentifierExpr;
     private:
-        SourceLocation DotLoc;
-
         Qualifiers Quals;
         std::string Identifier;
     public:
@@ -25,28 +23,28 @@ namespace AST {
         DotIdentifierExpr(const SourceLocation DotLoc,
                           const Qualifiers &Quals,
                           const std::string_view Identifier) noexcept
-        : Expr(ObjKind), DotLoc(DotLoc), Quals(Quals),
+        : Expr(ObjKind, DotLoc), Quals(Quals),
           Identifier(Identifier) {}
 
         explicit
         DotIdentifierExpr(const SourceLocation DotLoc,
                           const Qualifiers &Quals,
                           std::string &&Identifier) noexcept
-        : Expr(ObjKind), DotLoc(DotLoc), Quals(Quals),
+        : Expr(ObjKind, DotLoc), Quals(Quals),
           Identifier(std::move(Identifier)) {}
 
         explicit
         DotIdentifierExpr(const SourceLocation DotLoc,
                           Qualifiers &&Quals,
                           const std::string_view Identifier) noexcept
-        : Expr(ObjKind), DotLoc(DotLoc), Quals(std::move(Quals)),
+        : Expr(ObjKind, DotLoc), Quals(std::move(Quals)),
           Identifier(Identifier) {}
 
         explicit
         DotIdentifierExpr(const SourceLocation DotLoc,
                           Qualifiers &&Quals,
                           std::string &&Identifier) noexcept
-        : Expr(ObjKind), DotLoc(DotLoc), Quals(std::move(Quals)),
+        : Expr(ObjKind, DotLoc), Quals(std::move(Quals)),
           Identifier(std::move(Identifier)) {}
 
         [[nodiscard]]
@@ -60,12 +58,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getDotLoc() const noexcept {
-            return this->DotLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getDotLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getIdentifier() const noexcept {
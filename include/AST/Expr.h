@@ -10,7 +10,9 @@
 namespace AST {
     struct Expr : public Stmt {
     protected:
-        constexpr explicit Expr(const NodeKind Kind) noexcept : Stmt(Kind) {}
+        constexpr explicit
+        Expr(const NodeKind Kind, const SourceLocation Loc) noexcept
+        : Stmt(Kind, Loc) {}
     public:
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -22,7 +24,5 @@ namespace AST {
         constexpr static auto classof(const Stmt *const Node) noexcept {
             return IsOfKind(*Node);
         }
-
-        virtual SourceLocation getLoc() const noexcept = 0;
     };
 }
\ No newline at end of file
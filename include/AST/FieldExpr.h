@@ -13,8 +13,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::FieldExpr;
     protected:
-        SourceLocation Loc;
-
         bool IsArrow : 1 = false;
         Expr *Base;
 
@@ -25,7 +23,7 @@ namespace AST {
                   Expr *const Base,
                   const bool IsArrow,
                   const std::string_view MemberName)
-        : Expr(ObjKind), Loc(Loc), IsArrow(IsArrow), Base(Base),
+        : Expr(ObjKind, Loc), IsArrow(IsArrow), Base(Base),
           MemberName(MemberName) {}
 
         constexpr explicit
@@ -33,7 +31,7 @@ namespace AST {
                   Expr *const Base,
                   const bool IsArrow,
                   std::string &&MemberName)
-        : Expr(ObjKind), Loc(Loc), IsArrow(IsArrow), Base(Base),
+        : Expr(ObjKind, Loc), IsArrow(IsArrow), Base(Base),
           MemberName(std::move(MemberName)) {}
 
         [[nodiscard]]
@@ -46,11 +44,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getBase() const noexcept {
             return this->Base;
         }
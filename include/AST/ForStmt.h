@@ -13,8 +13,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ForStmt;
     protected:
-        SourceLocation ForLoc;
-
         CommaSepStmtList *Init;
         Expr *Cond;
         CommaSepStmtList *Step;
@@ -27,7 +25,7 @@ namespace AST {
                 Expr *const Cond,
                 CommaSepStmtList *const Step,
                 Stmt *const Body) noexcept
-        : Expr(ObjKind), ForLoc(ForLoc), Init(Init), Cond(Cond), Step(Step),
+        : Expr(ObjKind, ForLoc), Init(Init), Cond(Cond), Step(Step),
           Body(Body) {}
 
         [[nodiscard]]
@@ -41,12 +39,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getForLoc() const noexcept {
-            return this->ForLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getForLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getInit() const noexcept {
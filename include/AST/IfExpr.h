@@ -10,8 +10,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::IfExpr;
     protected:
-        SourceLocation IfLoc;
-
         Expr *Cond;
         Stmt *Then;
         Stmt *Else;
@@ -21,7 +19,7 @@ namespace AST {
                Expr &Cond,
                Stmt *const Then,
                Stmt *const Else) noexcept
-        : Expr(ObjKind), IfLoc(IfLoc), Cond(&Cond), Then(Then), Else(Else) {}
+        : Expr(ObjKind, IfLoc), Cond(&Cond), Then(Then), Else(Else) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -34,12 +32,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getIfLoc() const noexcept {
-            return this->IfLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getIfLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getCond() const noexcept {
@@ -57,7 +50,7 @@ namespace AST {
         constexpr auto setIfLoc(const SourceLocation IfLoc) noexcept
             -> decltype(*this)
         {
-            this->IfLoc = IfLoc;
+            this->Loc = IfLoc;
             return *this;
         }
 
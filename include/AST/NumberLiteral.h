@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include "Parse/ParseNumber.h"
+#include "Lex/ParseNumber.h"
 #include "Expr.h"
 
 namespace AST {
@@ -12,13 +12,12 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::NumberLiteral;
     protected:
-        SourceLocation Loc;
-        Parse::ParseNumberResult Number;
+        Lex::ParseNumberResult Number;
     public:
         constexpr explicit
         NumberLiteral(const SourceLocation Loc,
-                      const Parse::ParseNumberResult Number) noexcept
-        : Expr(ObjKind), Loc(Loc), Number(Number) {}
+                      const Lex::ParseNumberResult Number) noexcept
+        : Expr(ObjKind, Loc), Number(Number) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -30,17 +29,12 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getNumber() const noexcept {
             return this->Number;
         }
 
         constexpr auto
-        setNumber(const Parse::ParseNumberResult &Number) noexcept
+        setNumber(const Lex::ParseNumberResult &Number) noexcept
             -> decltype(*this)
         {
             this->Number = Number;
@@ -11,12 +11,11 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::OptionalUnwrapExpr;
     protected:
-        SourceLocation Loc;
         Expr *Base;
     public:
         constexpr explicit
         OptionalUnwrapExpr(const SourceLocation Loc, Expr *const Base) noexcept
-        : Expr(ObjKind), Loc(Loc), Base(Base) {}
+        : Expr(ObjKind, Loc), Base(Base) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -32,11 +31,6 @@ namespace AST {
             return this->Base;
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         constexpr auto setBase(Expr *const Base) noexcept -> decltype(*this) {
             this->Base = Base;
             return *this;
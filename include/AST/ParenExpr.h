@@ -10,13 +10,12 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ParenExpr;
     protected:
-        SourceLocation Loc;
         Expr *ChildExpr;
     public:
         constexpr explicit
         ParenExpr(const SourceLocation Loc,
                   Expr *const ChildExpr = nullptr) noexcept
-        : Expr(ObjKind), Loc(Loc), ChildExpr(ChildExpr) {}
+        : Expr(ObjKind, Loc), ChildExpr(ChildExpr) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -28,11 +27,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getChildExpr() const noexcept {
             return this->ChildExpr;
         }
@@ -4,58 +4,98 @@
  */
 
 #pragma once
-#include <unordered_map>
+#include <array>
+#include <cstdint>
 
 #include "Sema/InlinePolicy.h"
 #include "Source/SourceLocation.h"
 
 namespace AST {
-    enum class Qualifier {
+    enum class Qualifier : uint8_t {
         Mutable,
         Volatile,
         Comptime,
         Extern,
     };
 
+    // Qualifiers are stored as a bitmask, with the location of each qualifier
+    // kept in a fixed array indexed by Qualifier, so no allocation is needed.
+
     struct Qualifiers {
     protected:
-        std::unordered_map<Qualifier, SourceLocation> LocationList;
-        Sema::InlinePolicy InlinePolicy = Sema::InlinePolicy::None;
+        constexpr static auto InlineLocIndex =
+            static_cast<uint8_t>(Qualifier::Extern) + 1;
+
+        std::array<SourceLocation, InlineLocIndex + 1> LocationList;
+
+        uint8_t Bits : 4 = 0;
+        Sema::InlinePolicy InlinePolicy : 3 = Sema::InlinePolicy::None;
+
+        [[nodiscard]]
+        constexpr static auto getMask(const Qualifier Qual) noexcept {
+            return static_cast<uint8_t>(1 << static_cast<uint8_t>(Qual));
+        }
+
+        [[nodiscard]] constexpr auto has(const Qualifier Qual) const noexcept {
+            return (this->Bits & getMask(Qual)) != 0;
+        }
+
+        [[nodiscard]]
+        constexpr auto getLoc(const Qualifier Qual) const noexcept {
+            return this->LocationList[static_cast<uint8_t>(Qual)];
+        }
+
+        constexpr void
+        set(const Qualifier Qual,
+            const bool Value,
+            const SourceLocation Loc) noexcept
+        {
+            if (Value) {
+                // Keep the location of the first occurrence.
+                if (!this->has(Qual)) {
+                    this->LocationList[static_cast<uint8_t>(Qual)] = Loc;
+                    this->Bits |= getMask(Qual);
+                }
+            } else {
+                this->LocationList[static_cast<uint8_t>(Qual)] =
+                    SourceLocation();
 
-        SourceLocation InlineLoc;
+                this->Bits &= ~getMask(Qual);
+            }
+        }
     public:
-        explicit Qualifiers() noexcept = default;
+        constexpr explicit Qualifiers() noexcept = default;
 
         [[nodiscard]] constexpr auto isMutable() const noexcept {
-            return this->LocationList.contains(Qualifier::Mutable);
+            return this->has(Qualifier::Mutable);
         }
 
         [[nodiscard]] constexpr auto getMutableLoc() const noexcept {
-            return this->LocationList.at(Qualifier::Mutable);
+            return this->getLoc(Qualifier::Mutable);
         }
 
         [[nodiscard]] constexpr auto isVolatile() const noexcept {
-            return this->LocationList.contains(Qualifier::Volatile);
+            return this->has(Qualifier::Volatile);
         }
 
         [[nodiscard]] constexpr auto getVolatileLoc() const noexcept {
-            return this->LocationList.at(Qualifier::Volatile);
+            return this->getLoc(Qualifier::Volatile);
         }
 
         [[nodiscard]] constexpr auto isComptime() const noexcept {
-            return this->LocationList.contains(Qualifier::Comptime);
+            return this->has(Qualifier::Comptime);
         }
 
         [[nodiscard]] constexpr auto getComptimeLoc() const noexcept {
-            return this->LocationList.at(Qualifier::Comptime);
+            return this->getLoc(Qualifier::Comptime);
         }
 
         [[nodiscard]] constexpr auto isExtern() const noexcept {
-            return this->LocationList.contains(Qualifier::Extern);
+            return this->has(Qualifier::Extern);
         }
 
         [[nodiscard]] constexpr auto getExternLoc() const noexcept {
-            return this->LocationList.at(Qualifier::Extern);
+            return this->getLoc(Qualifier::Extern);
         }
 
         [[nodiscard]] constexpr auto getInlinePolicy() const noexcept {
@@ -63,16 +103,18 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getInlineLoc() const noexcept {
-            return this->InlineLoc;
+            return this->LocationList[InlineLocIndex];
         }
 
         [[nodiscard]] constexpr auto empty() const noexcept {
-            return this->LocationList.empty() &&
+            return this->Bits == 0 &&
                    this->InlinePolicy == Sema::InlinePolicy::None;
         }
 
         constexpr auto clear() noexcept -> decltype(*this) {
-            this->LocationList.clear();
+            this->LocationList.fill(SourceLocation());
+
+            this->Bits = 0;
             this->InlinePolicy = Sema::InlinePolicy::None;
 
             return *this;
@@ -82,12 +124,7 @@ namespace AST {
         setIsMutable(const bool IsMutable, const SourceLocation Loc) noexcept
             -> decltype(*this)
         {
-            if (IsMutable) {
-                this->LocationList.emplace(Qualifier::Mutable, Loc);
-            } else {
-                this->LocationList.erase(Qualifier::Mutable);
-            }
-
+            this->set(Qualifier::Mutable, IsMutable, Loc);
             return *this;
         }
 
@@ -95,12 +132,7 @@ namespace AST {
         setIsVolatile(const bool IsVolatile, const SourceLocation Loc) noexcept
             -> decltype(*this)
         {
-            if (IsVolatile) {
-                this->LocationList.emplace(Qualifier::Volatile, Loc);
-            } else {
-                this->LocationList.erase(Qualifier::Volatile);
-            }
-
+            this->set(Qualifier::Volatile, IsVolatile, Loc);
             return *this;
         }
 
@@ -108,12 +140,7 @@ namespace AST {
         setIsComptime(const bool IsComptime, const SourceLocation Loc) noexcept
             -> decltype(*this)
         {
-            if (IsComptime) {
-                this->LocationList.emplace(Qualifier::Comptime, Loc);
-            } else {
-                this->LocationList.erase(Qualifier::Comptime);
-            }
-
+            this->set(Qualifier::Comptime, IsComptime, Loc);
             return *this;
         }
 
@@ -124,10 +151,10 @@ namespace AST {
         {
             if (InlinePolicy != Sema::InlinePolicy::None) {
                 this->InlinePolicy = InlinePolicy;
-                this->InlineLoc = Loc;
+                this->LocationList[InlineLocIndex] = Loc;
             } else {
                 this->InlinePolicy = Sema::InlinePolicy::None;
-                this->InlineLoc = SourceLocation();
+                this->LocationList[InlineLocIndex] = SourceLocation();
             }
 
             return *this;
@@ -137,10 +164,22 @@ namespace AST {
         setIsExtern(const bool IsExtern, const SourceLocation Loc) noexcept
             -> decltype(*this)
         {
-            if (IsExtern) {
-                this->LocationList.emplace(Qualifier::Extern, Loc);
-            } else {
-                this->LocationList.erase(Qualifier::Extern);
+            this->set(Qualifier::Extern, IsExtern, Loc);
+            return *this;
+        }
+
+        constexpr auto shiftLocations(const SourceLocationShift Shift) noexcept
+            -> decltype(*this)
+        {
+            for (auto I = uint8_t(); I != InlineLocIndex; I++) {
+                if (this->has(static_cast<Qualifier>(I))) {
+                    this->LocationList[I] = this->LocationList[I].shifted(Shift);
+                }
+            }
+
+            if (this->InlinePolicy != Sema::InlinePolicy::None) {
+                this->LocationList[InlineLocIndex] =
+                    this->LocationList[InlineLocIndex].shifted(Shift);
             }
 
             return *this;
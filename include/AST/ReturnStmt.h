@@ -10,12 +10,11 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ReturnStmt;
     protected:
-        SourceLocation ReturnLoc;
         Expr *Value;
     public:
         constexpr explicit
         ReturnStmt(const SourceLocation ReturnLoc, Expr *const Value) noexcept
-        : Stmt(ObjKind), ReturnLoc(ReturnLoc), Value(Value) {}
+        : Stmt(ObjKind, ReturnLoc), Value(Value) {}
 
         [[nodiscard]] constexpr static auto none() noexcept {
             return ReturnStmt(SourceLocation::invalid(), /*Value=*/nullptr);
@@ -32,7 +31,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getReturnLoc() const noexcept {
-            return this->ReturnLoc;
+            return this->Loc;
         }
 
         [[nodiscard]] constexpr auto getValue() const noexcept {
@@ -42,7 +41,7 @@ namespace AST {
         constexpr auto setReturnLoc(const SourceLocation ReturnLoc) noexcept
             -> decltype(*this)
         {
-            this->ReturnLoc = ReturnLoc;
+            this->Loc = ReturnLoc;
             return *this;
         }
 
@@ -0,0 +1,14 @@
+/*
+ * AST/ShiftLocations.h
+ * © suhas pai
+ */
+
+#pragma once
+#include "AST/Stmt.h"
+
+namespace AST {
+    // Moves the location of Stmt, and of every node and qualifier within it,
+    // by Shift. Used to reuse a statement after an edit earlier in its file.
+
+    void ShiftLocations(Stmt &Stmt, SourceLocationShift Shift) noexcept;
+}
@@ -3,17 +3,44 @@
  */
 
 #pragma once
+
+#include "Source/SourceLocation.h"
 #include "NodeKind.h"
 
 namespace AST {
+    // Common header of every AST node. Dispatch is done on Kind through
+    // classof(), so nodes carry no vtable, and the location lives here instead
+    // of being repeated (and overridden) in every subclass.
+
     struct Stmt {
     private:
         NodeKind Kind;
     protected:
+        // Spare per-node bits for subclasses. These fit in the padding between
+        // Kind and Loc, so they cost nothing.
+
+        uint8_t Flags = 0;
+        SourceLocation Loc;
+
         constexpr explicit Stmt(const NodeKind Kind) noexcept : Kind(Kind) {}
+
+        constexpr explicit
+        Stmt(const NodeKind Kind, const SourceLocation Loc) noexcept
+        : Kind(Kind), Loc(Loc) {}
     public:
         [[nodiscard]] constexpr auto getKind() const noexcept {
             return this->Kind;
         }
+
+        [[nodiscard]] constexpr auto getLoc() const noexcept {
+            return this->Loc;
+        }
+
+        constexpr auto setLoc(const SourceLocation Loc) noexcept
+            -> decltype(*this)
+        {
+            this->Loc = Loc;
+            return *this;
+        }
     };
-}
\ No newline at end of file
+}
@@ -5,6 +5,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "ADT/BumpAllocator.h"
 #include "Expr.h"
 
 namespace AST {
@@ -12,17 +15,20 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::StringLiteral;
     protected:
-        SourceLocation Loc;
-        std::string Value;
+        // Not owned. Points into the source-buffer when the literal has no
+        // escape-sequences, and into arena storage otherwise; both outlive the
+        // AST.
+
+        std::string_view Value;
     public:
         constexpr explicit
         StringLiteral(const SourceLocation Loc,
                       const std::string_view Value) noexcept
-        : Expr(ObjKind), Loc(Loc), Value(Value) {}
+        : Expr(ObjKind, Loc), Value(Value) {}
 
-        constexpr explicit
+        explicit
         StringLiteral(const SourceLocation Loc, std::string &&Value) noexcept
-        : Expr(ObjKind), Loc(Loc), Value(std::move(Value)) {}
+        : Expr(ObjKind, Loc), Value(ADT::ArenaCopy(std::string_view(Value))) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -34,11 +40,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]]
         constexpr auto value() const noexcept -> std::string_view {
             return this->Value;
@@ -51,10 +52,9 @@ namespace AST {
             return *this;
         }
 
-        constexpr auto setValue(std::string &&Value) noexcept -> decltype(*this)
-        {
-            this->Value = std::move(Value);
+        auto setValue(std::string &&Value) noexcept -> decltype(*this) {
+            this->Value = ADT::ArenaCopy(std::string_view(Value));
             return *this;
         }
     };
-}
\ No newline at end of file
+}
@@ -13,7 +13,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::ArrayPointerType;
     protected:
-        SourceLocation Loc;
         Qualifiers Quals;
 
         Expr *Base;
@@ -22,13 +21,13 @@ namespace AST {
         ArrayPointerTypeExpr(const SourceLocation Loc,
                              const Qualifiers &Quals,
                              Expr *const Base) noexcept
-        : Expr(ObjKind), Loc(Loc), Quals(Quals), Base(Base) {}
+        : Expr(ObjKind, Loc), Quals(Quals), Base(Base) {}
 
         explicit
         ArrayPointerTypeExpr(const SourceLocation Loc,
                              Qualifiers &&Quals,
                              Expr *const Base) noexcept
-        : Expr(ObjKind), Loc(Loc), Quals(std::move(Quals)), Base(Base) {}
+        : Expr(ObjKind, Loc), Quals(std::move(Quals)), Base(Base) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -52,11 +51,6 @@ namespace AST {
             return this->Base;
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         constexpr auto setBase(Expr *const Base) noexcept
             -> decltype(*this)
         {
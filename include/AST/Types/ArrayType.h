@@ -13,8 +13,6 @@ namespace AST {
     public:
         constexpr static auto NodeKind = NodeKind::ArrayType;
     protected:
-        SourceLocation BracketLoc;
-
         Expr *SizeExpr;
         Expr *ConstraintExpr;
 
@@ -27,7 +25,7 @@ namespace AST {
                       Expr *const Constraint,
                       Expr *const Base,
                       const Qualifiers &Quals) noexcept
-        : Expr(NodeKind::ArrayType), BracketLoc(BracketLoc),
+        : Expr(NodeKind::ArrayType, BracketLoc),
           SizeExpr(Size), ConstraintExpr(Constraint), Base(Base),
           Quals(Quals) {}
 
@@ -37,7 +35,7 @@ namespace AST {
                       Expr *const Constraint,
                       Expr *const Base,
                       Qualifiers &&Quals) noexcept
-        : Expr(NodeKind::ArrayType), BracketLoc(BracketLoc),
+        : Expr(NodeKind::ArrayType, BracketLoc),
           SizeExpr(Size), ConstraintExpr(Constraint), Base(Base),
           Quals(std::move(Quals)) {}
 
@@ -64,12 +62,7 @@ namespace AST {
         }
 
         [[nodiscard]] constexpr auto getBracketLoc() const noexcept {
-            return this->BracketLoc;
-        }
-
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->getBracketLoc();
+            return this->Loc;
         }
 
         [[nodiscard]] inline auto &getQualifiers() const noexcept {
@@ -102,7 +95,7 @@ namespace AST {
         constexpr auto setBracketLoc(const SourceLocation BracketLoc) noexcept
             -> decltype(*this)
         {
-            this->BracketLoc = BracketLoc;
+            this->Loc = BracketLoc;
             return *this;
         }
     };
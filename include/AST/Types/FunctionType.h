@@ -8,6 +8,8 @@
 #include <span>
 #include <vector>
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/Expr.h"
 
 namespace AST {
@@ -15,23 +17,22 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::FunctionType;
     protected:
-        SourceLocation Loc;
-        std::vector<Stmt *> ParamList;
+        std::span<Stmt *> ParamList;
         Expr *ReturnType;
     public:
         constexpr explicit
         FunctionTypeExpr(const SourceLocation Loc,
                          const std::span<Stmt *> ParamList,
                          Expr *const ReturnType) noexcept
-        : Expr(ObjKind), Loc(Loc),
-          ParamList(ParamList.begin(), ParamList.end()),
+        : Expr(ObjKind, Loc),
+          ParamList(ParamList),
           ReturnType(ReturnType) {}
 
-        constexpr explicit
+        explicit
         FunctionTypeExpr(const SourceLocation Loc,
                          std::vector<Stmt *> &&ParamList,
                          Expr *const ReturnType) noexcept
-        : Expr(ObjKind), Loc(Loc), ParamList(std::move(ParamList)),
+        : Expr(ObjKind, Loc), ParamList(ADT::ArenaCopy(ParamList)),
           ReturnType(ReturnType) {}
 
         [[nodiscard]]
@@ -44,11 +45,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getParamList() const noexcept {
             return std::span(this->ParamList);
         }
@@ -11,12 +11,11 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::OptionalType;
     protected:
-        SourceLocation Loc;
         Expr *Operand;
     public:
         constexpr explicit
         OptionalTypeExpr(const SourceLocation Loc, Expr *const Operand) noexcept
-        : Expr(ObjKind), Loc(Loc), Operand(Operand) {}
+        : Expr(ObjKind, Loc), Operand(Operand) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -32,11 +31,6 @@ namespace AST {
             return this->Operand;
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         constexpr auto setOperand(Expr &Operand) noexcept -> decltype(*this) {
             this->Operand = &Operand;
             return *this;
@@ -12,7 +12,6 @@ namespace AST {
     public:
         constexpr static auto ObjKind = NodeKind::UnaryOperation;
     protected:
-        SourceLocation Loc;
         Parse::UnaryOperator Operator;
 
         Expr *Operand;
@@ -21,7 +20,7 @@ namespace AST {
         UnaryOperation(const SourceLocation Loc,
                        const Parse::UnaryOperator Operator,
                        Expr *const Operand = nullptr) noexcept
-        : Expr(ObjKind), Loc(Loc), Operator(Operator), Operand(Operand) {}
+        : Expr(ObjKind, Loc), Operator(Operator), Operand(Operand) {}
 
         [[nodiscard]]
         constexpr static auto IsOfKind(const Stmt &Stmt) noexcept {
@@ -33,11 +32,6 @@ namespace AST {
             return IsOfKind(*Node);
         }
 
-        [[nodiscard]]
-        constexpr SourceLocation getLoc() const noexcept override {
-            return this->Loc;
-        }
-
         [[nodiscard]] constexpr auto getOperator() const noexcept {
             return this->Operator;
         }
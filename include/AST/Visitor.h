@@ -0,0 +1,160 @@
+/*
+ * AST/Visitor.h
+ * © suhas pai
+ */
+
+#pragma once
+#include <type_traits>
+
+#include "AST/Decls/ArrayBindingParamVarDecl.h"
+#include "AST/Decls/ArrayDecl.h"
+#include "AST/Decls/ClosureDecl.h"
+#include "AST/Decls/EnumDecl.h"
+#include "AST/Decls/EnumMemberDecl.h"
+#include "AST/Decls/FieldDecl.h"
+#include "AST/Decls/FunctionDecl.h"
+#include "AST/Decls/InlineArrayParamVarDecl.h"
+#include "AST/Decls/InterfaceDecl.h"
+#include "AST/Decls/ObjectBindingParamVarDecl.h"
+#include "AST/Decls/OptionalFieldDecl.h"
+#include "AST/Decls/ParamVarDecl.h"
+#include "AST/Decls/ShapeDecl.h"
+#include "AST/Decls/StructDecl.h"
+#include "AST/Decls/TupleDecl.h"
+#include "AST/Decls/UnionDecl.h"
+#include "AST/Decls/VarDecl.h"
+
+#include "AST/Types/ArrayPointerType.h"
+#include "AST/Types/ArrayType.h"
+#include "AST/Types/FunctionType.h"
+#include "AST/Types/OptionalType.h"
+#include "AST/Types/PointerType.h"
+
+#include "AST/ArraySubscriptExpr.h"
+#include "AST/BinaryOperation.h"
+#include "AST/CallExpr.h"
+#include "AST/CaptureAllByRefExpr.h"
+#include "AST/CaptureAllByValueExpr.h"
+#include "AST/CastExpr.h"
+#include "AST/CharLiteral.h"
+#include "AST/CommaSepStmtList.h"
+#include "AST/CompoundStmt.h"
+#include "AST/DeclRefExpr.h"
+#include "AST/DerefExpr.h"
+#include "AST/DotIdentifierExpr.h"
+#include "AST/FieldExpr.h"
+#include "AST/ForStmt.h"
+#include "AST/IfExpr.h"
+#include "AST/NumberLiteral.h"
+#include "AST/OptionalUnwrapExpr.h"
+#include "AST/ParenExpr.h"
+#include "AST/ReturnStmt.h"
+#include "AST/StringLiteral.h"
+#include "AST/UnaryOperation.h"
+
+#include "llvm/Support/Casting.h"
+
+// Every NodeKind that has a node class, as X(NodeKind, Class).
+
+#define AST_VISITOR_NODE_LIST(X) \
+    X(BinaryOperation, BinaryOperation) \
+    X(UnaryOperation, UnaryOperation) \
+    X(CharLiteral, CharLiteral) \
+    X(NumberLiteral, NumberLiteral) \
+    X(StringLiteral, StringLiteral) \
+    X(DeclRefExpr, DeclRefExpr) \
+    X(DotIdentifierExpr, DotIdentifierExpr) \
+    X(OptionalUnwrapExpr, OptionalUnwrapExpr) \
+    X(ParenExpr, ParenExpr) \
+    X(ArrayDecl, ArrayDecl) \
+    X(ClosureDecl, ClosureDecl) \
+    X(EnumDecl, EnumDecl) \
+    X(FunctionDecl, FunctionDecl) \
+    X(InterfaceDecl, InterfaceDecl) \
+    X(StructDecl, StructDecl) \
+    X(ShapeDecl, ShapeDecl) \
+    X(TupleDecl, TupleDecl) \
+    X(UnionDecl, UnionDecl) \
+    X(LvalueNamedDecl, LvalueNamedDecl) \
+    X(EnumMemberDecl, EnumMemberDecl) \
+    X(FieldDecl, FieldDecl) \
+    X(OptionalFieldDecl, OptionalFieldDecl) \
+    X(VarDecl, VarDecl) \
+    X(ParamVarDecl, ParamVarDecl) \
+    X(ArrayBindingVarDecl, ArrayBindingVarDecl) \
+    X(ArrayBindingParamVarDecl, ArrayBindingParamVarDecl) \
+    X(ObjectBindingVarDecl, ObjectBindingVarDecl) \
+    X(ObjectBindingParamVarDecl, ObjectBindingParamVarDecl) \
+    X(InlineTupleParamVarDecl, InlineTupleParamVarDecl) \
+    X(CallExpr, CallExpr) \
+    X(FieldExpr, FieldExpr) \
+    X(IfExpr, IfExpr) \
+    X(ArraySubscriptExpr, ArraySubscriptExpr) \
+    X(CastExpr, CastExpr) \
+    X(DerefExpr, DerefExpr) \
+    X(CaptureAllByRefExpr, CaptureAllByRefExpr) \
+    X(CaptureAllByValueExpr, CaptureAllByValueExpr) \
+    X(ArrayType, ArrayTypeExpr) \
+    X(FunctionType, FunctionTypeExpr) \
+    X(OptionalType, OptionalTypeExpr) \
+    X(PointerType, PointerTypeExpr) \
+    X(ArrayPointerType, ArrayPointerTypeExpr) \
+    X(CompoundStmt, CompoundStmt) \
+    X(ForStmt, ForStmt) \
+    X(CommaSepStmtList, CommaSepStmtList) \
+    X(ReturnStmt, ReturnStmt)
+
+namespace AST {
+    // Dispatches on a node's kind to Derived's visit<Class>() method, with no
+    // virtual calls. Derived only declares the methods it cares about; every
+    // other node (and every kind without a node class) goes to visitStmt().
+    //
+    // Usage:
+    //     struct Printer : public AST::StmtVisitor<Printer> {
+    //         void visitCallExpr(AST::CallExpr &Call) noexcept { ... }
+    //         void visitStmt(AST::Stmt &Stmt) noexcept { ... }
+    //     };
+
+    template <typename Derived, typename RetTy = void, bool IsConst = false>
+    struct StmtVisitor {
+    protected:
+        template <typename T>
+        using Ref = std::conditional_t<IsConst, const T &, T &>;
+
+        [[nodiscard]] constexpr auto &derived() noexcept {
+            return *static_cast<Derived *>(this);
+        }
+    public:
+        auto visit(Ref<Stmt> Stmt) noexcept -> RetTy {
+            switch (Stmt.getKind()) {
+            #define AST_VISITOR_CASE(Kind, Class) \
+                case NodeKind::Kind: \
+                    return this->derived().visit##Class( \
+                        llvm::cast<Class>(Stmt));
+
+                AST_VISITOR_NODE_LIST(AST_VISITOR_CASE)
+            #undef AST_VISITOR_CASE
+
+                default:
+                    break;
+            }
+
+            return this->derived().visitStmt(Stmt);
+        }
+
+        auto visitStmt(Ref<Stmt>) noexcept -> RetTy {
+            return RetTy();
+        }
+
+    #define AST_VISITOR_DEFAULT(Kind, Class) \
+        auto visit##Class(Ref<Class> Node) noexcept -> RetTy { \
+            return this->derived().visitStmt(Node); \
+        }
+
+        AST_VISITOR_NODE_LIST(AST_VISITOR_DEFAULT)
+    #undef AST_VISITOR_DEFAULT
+    };
+
+    template <typename Derived, typename RetTy = void>
+    using ConstStmtVisitor = StmtVisitor<Derived, RetTy, /*IsConst=*/true>;
+}
@@ -19,10 +19,25 @@
 #include "AST/StringLiteral.h"
 #include "AST/UnaryOperation.h"
 
+#include "Sema/Types/Builtin.h"
+
 #include "llvm/IR/Value.h"
 #include "Handler.h"
 
 namespace Backend::LLVM {
+    // Returns null for types LLVM has no equivalent of, like f8.
+    auto
+    GetLLVMType(const Sema::BuiltinType &Type,
+                llvm::LLVMContext &Context) noexcept -> llvm::Type *;
+
+    // The builtin type that Expr evaluates to. Values of unknown type are
+    // f64.
+
+    auto
+    GetExprType(const AST::Expr &Expr,
+                Backend::LLVM::ValueMap &ValueMap) noexcept
+        -> const Sema::BuiltinType &;
+
     auto
     BinaryOperationCodegen(AST::BinaryOperation &BinOp,
                            Backend::LLVM::Handler &Handler,
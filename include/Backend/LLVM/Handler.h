@@ -6,10 +6,17 @@
 #include <span>
 
 #include "ADT/StringMap.h"
+
+#include "AST/Decls/FunctionDecl.h"
 #include "AST/Decls/LvalueNamedDecl.h"
+#include "AST/DeclRefExpr.h"
 
 #include "Diag/Consumer.h"
 #include "Parse/ParseUnit.h"
+#include "Sema/Types/Builtin.h"
+#include "Sema/Types/Context.h"
+
+#include "llvm/ADT/DenseMap.h"
 
 #include "llvm/Analysis/CGSCCPassManager.h"
 #include "llvm/Analysis/LoopAnalysisManager.h"
@@ -23,17 +30,85 @@
 #include "llvm/Support/Error.h"
 
 namespace Backend::LLVM {
+    // Holds the value generated for each declaration, along with its builtin
+    // type, since LLVM's integer types don't tell signed from unsigned. Sema
+    // gives every local a slot, so the locals of the function being
+    // generated are a flat array indexed by slot. Top-level declarations are
+    // keyed on the declaration.
+
     struct ValueMap {
+    public:
+        struct Entry {
+            llvm::Value *Value = nullptr;
+            const Sema::BuiltinType *Type = nullptr;
+        };
     protected:
-        ADT::UnorderedStringMap<std::vector<llvm::Value *>> Map;
+        std::vector<Entry> SlotList;
+        llvm::DenseMap<const AST::LvalueNamedDecl *, Entry> GlobalMap;
+
+        llvm::DenseMap<const llvm::Function *, const Sema::BuiltinType *>
+            ReturnTypeMap;
+
+        // The type of each operation already worked out, so each expression
+        // of a chain is typed once rather than once for every operation
+        // above it.
+        llvm::DenseMap<const AST::Expr *, const Sema::BuiltinType *>
+            ExprTypeMap;
+
+        // Number of functions being generated. Functions nested in another
+        // one use the slots of the outermost one.
+        uint32_t FunctionDepth = 0;
+
+        [[nodiscard]]
+        auto getEntry(const AST::LvalueNamedDecl &Decl) noexcept -> Entry &;
+
+        [[nodiscard]]
+        auto getEntry(const AST::LvalueNamedDecl &Decl) const noexcept
+            -> const Entry *;
     public:
-        auto add(std::string_view Name, llvm::Value *Val) noexcept
+        void beginFunction(const AST::FunctionDecl &FuncDecl) noexcept;
+        void endFunction() noexcept;
+
+        auto setValue(const AST::LvalueNamedDecl &Decl,
+                      llvm::Value *Val) noexcept -> decltype(*this);
+
+        [[nodiscard]]
+        auto getValue(const AST::LvalueNamedDecl &Decl) const noexcept
+            -> llvm::Value *;
+
+        // Returns null if Expr wasn't resolved to a declaration with a value.
+        [[nodiscard]]
+        auto getValue(const AST::DeclRefExpr &Expr) const noexcept
+            -> llvm::Value *;
+
+        // A declaration's type can be set before its value is created, as
+        // with parameters, whose types are needed to create their function.
+
+        auto setType(const AST::LvalueNamedDecl &Decl,
+                     const Sema::BuiltinType &Type) noexcept
+            -> decltype(*this);
+
+        // Returns the type of the declaration Expr refers to, or null if it
+        // has none yet.
+        [[nodiscard]]
+        auto getType(const AST::DeclRefExpr &Expr) const noexcept
+            -> const Sema::BuiltinType *;
+
+        auto setReturnType(const llvm::Function &Function,
+                           const Sema::BuiltinType &Type) noexcept
             -> decltype(*this);
-        auto setValue(std::string_view Name, llvm::Value *Val) noexcept
+
+        [[nodiscard]]
+        auto getReturnType(const llvm::Function &Function) const noexcept
+            -> const Sema::BuiltinType *;
+
+        auto setExprType(const AST::Expr &Expr,
+                         const Sema::BuiltinType &Type) noexcept
             -> decltype(*this);
 
-        auto getValue(std::string_view Name) const noexcept -> llvm::Value *;
-        auto removeValue(std::string_view Name) noexcept -> decltype(*this);
+        [[nodiscard]]
+        auto getExprType(const AST::Expr &Expr) const noexcept
+            -> const Sema::BuiltinType *;
 
         auto clear() noexcept -> decltype(*this);
     };
@@ -67,10 +142,12 @@ namespace Backend::LLVM {
         std::unique_ptr<llvm::PassInstrumentationCallbacks> PIC;
         std::unique_ptr<llvm::StandardInstrumentations> SI;
 
+        // Owns the types that type expressions resolve to.
+        Sema::TypeContext TypeContext;
+
         llvm::ExitOnError ExitOnErr;
         DiagnosticConsumer &Diag;
 
-        static void initializeLLVM() noexcept;
         virtual void allocCoreFields(const llvm::StringRef &Name) noexcept;
 
         void initialize(const llvm::StringRef &Name) noexcept;
@@ -81,6 +158,10 @@ namespace Backend::LLVM {
     public:
         explicit Handler(DiagnosticConsumer &Diag) noexcept;
 
+        // Sets up the native target. Only does work the first time it's
+        // called.
+        static void initializeLLVM() noexcept;
+
         [[nodiscard]] constexpr auto &getContext() noexcept {
             return *this->TheContext;
         }
@@ -137,6 +218,10 @@ namespace Backend::LLVM {
             return *this->SI;
         }
 
+        [[nodiscard]] constexpr auto &getTypeContext() noexcept {
+            return this->TypeContext;
+        }
+
         [[nodiscard]] constexpr auto &getDiag() const noexcept {
             return this->Diag;
         }
@@ -76,16 +76,11 @@ namespace Backend::LLVM {
             return this->Unit;
         }
 
+        // Functions in TSM with the same code are merged before it's added.
         [[nodiscard]] auto
         addModule(llvm::orc::ThreadSafeModule TSM,
                   llvm::orc::ResourceTrackerSP RT = nullptr) noexcept
-        {
-            if (RT == nullptr) {
-                RT = this->MainJD.getDefaultResourceTracker();
-            }
-
-            return this->CODLayer.add(RT, std::move(TSM));
-        }
+            -> llvm::Error;
 
         [[nodiscard]] auto lookup(const llvm::StringRef Name) noexcept
             -> llvm::Expected<llvm::orc::ExecutorSymbolDef>
@@ -6,15 +6,72 @@
 #pragma once
 
 #include <print>
+#include <span>
 #include <vector>
 
 #include "Basic/ANSI.h"
 #include "Diag/Message.h"
+#include "Source/SourceManager.h"
 
 struct DiagnosticConsumer {
     virtual void consume(const DiagnosticMessage &Message) noexcept = 0;
 };
 
+// Collects messages so they can be replayed into another consumer later, in
+// the order they were emitted. Used by work that runs off the main thread.
+
+struct BufferedDiagnosticConsumer : public DiagnosticConsumer {
+protected:
+    std::vector<DiagnosticMessage> MessageList;
+public:
+    explicit BufferedDiagnosticConsumer() noexcept = default;
+
+    void consume(const DiagnosticMessage &Message) noexcept override {
+        this->MessageList.emplace_back(Message);
+    }
+
+    [[nodiscard]] constexpr auto messageCount() const noexcept {
+        return this->MessageList.size();
+    }
+
+    [[nodiscard]] constexpr auto getMessageList() const noexcept {
+        return std::span(this->MessageList);
+    }
+
+    constexpr auto
+    replay(DiagnosticConsumer &Diag,
+           const size_t Begin,
+           const size_t End) const noexcept -> decltype(*this)
+    {
+        for (auto I = Begin; I != End; I++) {
+            Diag.consume(this->MessageList[I]);
+        }
+
+        return *this;
+    }
+
+    constexpr auto replay(DiagnosticConsumer &Diag) const noexcept
+        -> decltype(*this)
+    {
+        return this->replay(Diag, 0, this->MessageList.size());
+    }
+
+    // Moves every message forward by Index bytes and Row rows, for messages
+    // emitted while working on a piece of a larger buffer.
+
+    constexpr auto
+    shiftLocations(const uint32_t Index, const uint32_t Row) noexcept
+        -> decltype(*this)
+    {
+        for (auto &Message : this->MessageList) {
+            Message.Location.Index += Index;
+            Message.Location.Row += Row;
+        }
+
+        return *this;
+    }
+};
+
 struct SourceFileDiagnosticConsumer : public DiagnosticConsumer {
 protected:
     std::string FilePath;
@@ -64,3 +121,109 @@ public:
         return *this;
     }
 };
+
+// Collects messages for every file of a SourceManager in one list. Messages
+// only keep their global location, and the file, row and column are worked
+// out when printing.
+//
+// Tokens and AST nodes still carry file-local locations, so messages are
+// consumed through the FileConsumer of the file they're about, which adds
+// the file's base offset.
+
+struct SourceManagerDiagnosticConsumer {
+protected:
+    struct Entry {
+        DiagnosticLevel Level;
+        GlobalSourceLocation Location;
+
+        std::string Message;
+    };
+
+    const ADT::SourceManager &SrcManager;
+
+    std::vector<Entry> MessageList;
+    uint64_t ErrorCount = 0;
+public:
+    struct FileConsumer : public DiagnosticConsumer {
+    protected:
+        SourceManagerDiagnosticConsumer &Diag;
+        const ADT::SourceFile &File;
+    public:
+        explicit
+        FileConsumer(SourceManagerDiagnosticConsumer &Diag,
+                     const ADT::SourceFile &File) noexcept
+        : Diag(Diag), File(File) {}
+
+        void consume(const DiagnosticMessage &Message) noexcept override {
+            this->Diag.consume(Message.Level,
+                               this->File.getGlobalLocation(Message.Location),
+                               Message.Message);
+        }
+    };
+
+    explicit
+    SourceManagerDiagnosticConsumer(
+        const ADT::SourceManager &SrcManager) noexcept
+    : SrcManager(SrcManager) {}
+
+    [[nodiscard]] auto forFile(const ADT::SourceFile &File) noexcept {
+        return FileConsumer(*this, File);
+    }
+
+    void
+    consume(const DiagnosticLevel Level,
+            const GlobalSourceLocation Location,
+            const std::string_view Message) noexcept
+    {
+        if (Level == DiagnosticLevel::Error) {
+            this->ErrorCount++;
+        }
+
+        this->MessageList.emplace_back(Entry {
+            .Level = Level,
+            .Location = Location,
+            .Message = std::string(Message),
+        });
+    }
+
+    [[nodiscard]] constexpr auto hasMessages() const noexcept {
+        return !this->MessageList.empty();
+    }
+
+    // Whether an error was ever consumed, including ones already printed.
+    [[nodiscard]] constexpr auto hasErrors() const noexcept {
+        return this->ErrorCount != 0;
+    }
+
+    // The number of errors ever consumed. Comparing it against an earlier
+    // count tells whether the work in between had any errors.
+    [[nodiscard]] constexpr auto getErrorCount() const noexcept {
+        return this->ErrorCount;
+    }
+
+    // Prints the messages consumed since the last call to print().
+    auto print() noexcept -> decltype(*this) {
+        for (const auto &Entry : this->MessageList) {
+            const auto Level =
+                Entry.Level == DiagnosticLevel::Error ?
+                    ANSI_BHRED "error" ANSI_CRESET :
+                    ANSI_BHYEL "warning" ANSI_CRESET;
+
+            const auto Resolved = this->SrcManager.resolve(Entry.Location);
+            if (!Resolved.has_value()) {
+                std::print("{}: {}\n", Level, Entry.Message);
+                continue;
+            }
+
+            std::print("{}:{}:{} {}: {}\n",
+                       Resolved->File->Path,
+                       Resolved->Loc.Row,
+                       Resolved->Loc.Column,
+                       Level,
+                       Entry.Message);
+        }
+
+        this->MessageList.clear();
+        return *this;
+    }
+};
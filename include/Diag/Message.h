@@ -19,4 +19,8 @@ struct DiagnosticMessage {
     SourceLocation Location;
 
     std::string Message;
+
+    // Set for a reused decl name, which is reported when a statement is added
+    // to its unit rather than when the statement is parsed.
+    bool IsReusedDeclName : 1 = false;
 };
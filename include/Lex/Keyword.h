@@ -4,64 +4,64 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
 #include <string_view>
-#include <utility>
-
-#include "ADT/SmallArrayMap.h"
 
 namespace Lex {
-    enum class Keyword {
-        Let,
-        Mut,
-        Function,
-        If,
-        Else,
-        Return,
-        Volatile,
-        Struct,
-        Class,
-        Shape,
-        Union,
-        Interface,
-        Impl,
-        Enum,
-        And,
-        Or,
-        For,
-        While,
-        Inline,
-        Comptime,
-        Default,
-        In,
-        As,
-        Discardable,
+    enum class Keyword : uint8_t {
+    #define KEYWORD(Kind, Lexeme, Precedence) Kind,
+    #include "Lex/Tokens.def"
+    };
+
+    constexpr auto KeywordCount =
+        static_cast<uint8_t>(Keyword::Discardable) + 1;
+
+    constexpr auto KeywordLexemeList =
+        std::array<std::string_view, KeywordCount> {
+    #define KEYWORD(Kind, Lexeme, Precedence) Lexeme,
+    #include "Lex/Tokens.def"
     };
 
-    const auto KeywordToLexemeMap =
-        ADT::SmallArrayMap<Keyword, std::string_view, 24>({
-            std::make_pair(Keyword::Let, "let"),
-            std::make_pair(Keyword::Mut, "mut"),
-            std::make_pair(Keyword::Function, "func"),
-            std::make_pair(Keyword::If, "if"),
-            std::make_pair(Keyword::Else, "else"),
-            std::make_pair(Keyword::Return, "return"),
-            std::make_pair(Keyword::Volatile, "volatile"),
-            std::make_pair(Keyword::Struct, "struct"),
-            std::make_pair(Keyword::Class, "class"),
-            std::make_pair(Keyword::Shape, "shape"),
-            std::make_pair(Keyword::Union, "union"),
-            std::make_pair(Keyword::Interface, "interface"),
-            std::make_pair(Keyword::Impl, "impl"),
-            std::make_pair(Keyword::Enum, "enum"),
-            std::make_pair(Keyword::And, "and"),
-            std::make_pair(Keyword::Or, "or"),
-            std::make_pair(Keyword::While, "for"),
-            std::make_pair(Keyword::For, "for"),
-            std::make_pair(Keyword::Inline, "inline"),
-            std::make_pair(Keyword::Comptime, "comptime"),
-            std::make_pair(Keyword::Default, "default"),
-            std::make_pair(Keyword::In, "in"),
-            std::make_pair(Keyword::As, "as"),
-            std::make_pair(Keyword::Discardable, "discardable")
-        });
-}
\ No newline at end of file
+    [[nodiscard]]
+    constexpr auto KeywordGetLexeme(const Keyword Keyword) noexcept {
+        return KeywordLexemeList[static_cast<uint8_t>(Keyword)];
+    }
+
+    // For each lowercase letter, a mask of the keywords whose lexeme starts
+    // with that letter, so a lookup only compares against a few keywords.
+
+    constexpr auto KeywordFirstLetterMaskList = [] {
+        static_assert(KeywordCount <= 32, "Keyword mask is too small");
+
+        auto Result = std::array<uint32_t, 26>();
+        for (auto I = uint8_t(); I != KeywordCount; I++) {
+            Result[KeywordLexemeList[I].front() - 'a'] |= uint32_t(1) << I;
+        }
+
+        return Result;
+    }();
+
+    [[nodiscard]]
+    constexpr auto KeywordForLexeme(const std::string_view Lexeme) noexcept
+        -> std::optional<Keyword>
+    {
+        if (Lexeme.empty() || Lexeme.front() < 'a' || Lexeme.front() > 'z') {
+            return std::nullopt;
+        }
+
+        auto Mask = KeywordFirstLetterMaskList[Lexeme.front() - 'a'];
+        while (Mask != 0) {
+            const auto Index = std::countr_zero(Mask);
+            if (KeywordLexemeList[Index] == Lexeme) {
+                return static_cast<Keyword>(Index);
+            }
+
+            Mask &= Mask - 1;
+        }
+
+        return std::nullopt;
+    }
+}
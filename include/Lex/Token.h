@@ -8,7 +8,6 @@
 #include <cassert>
 #include <string_view>
 
-#include "ADT/SmallArrayMap.h"
 #include "Source/SourceLocation.h"
 
 #include "Keyword.h"
@@ -55,12 +54,12 @@ namespace Lex {
     TokenStringIsKeyword(const std::string_view TokenString,
                          const Keyword Keyword) noexcept
     {
-        return TokenString == KeywordToLexemeMap[Keyword];
+        return TokenString == KeywordGetLexeme(Keyword);
     }
 
     [[nodiscard]] constexpr
     auto KeywordLexemeGetKeyword(const std::string_view Lexeme) noexcept {
-        const auto Keyword = KeywordToLexemeMap.keyFor(Lexeme);
+        const auto Keyword = KeywordForLexeme(Lexeme);
         if (Keyword.has_value()) {
             return Keyword.value();
         }
@@ -11,30 +11,79 @@
 #include "Diag/Consumer.h"
 
 #include "Lex/Infos.h"
+#include "Lex/ParseNumber.h"
 #include "Lex/Token.h"
 
 #include "Source/SourceBuffer.h"
 
 namespace Lex {
+    struct TokenBufferOptions {
+        bool LexInParallel : 1 = true;
+    };
+
+    // RemovedLength bytes at Offset were replaced by InsertedLength bytes.
+    struct TextEdit {
+        uint32_t Offset;
+        uint32_t RemovedLength;
+        uint32_t InsertedLength;
+    };
+
+    // How the tokens of a buffer changed after a TextEdit. Tokens [Begin,
+    // OldEnd) of the old buffer were replaced by tokens [Begin, NewEnd) of the
+    // new one. Every later token is unchanged, except for being moved by
+    // Shift.
+
+    struct TokenEdit {
+        uint32_t Begin;
+        uint32_t OldEnd;
+        uint32_t NewEnd;
+
+        SourceLocationShift Shift;
+    };
+
     struct TokenBuffer {
+    public:
+        // The value of a number-literal token, converted while lexing so the
+        // parser doesn't have to scan the literal a second time.
+
+        struct NumberInfo {
+            uint32_t Index;
+            Lex::ParseNumberResult Result;
+        };
     protected:
         const ADT::SourceBuffer &SrcBuffer;
 
         std::vector<LineInfo> LineInfoList;
         std::vector<Token> TokenList;
 
+        // Sorted by Index, as tokens are lexed in order.
+        std::vector<NumberInfo> NumberInfoList;
+
         explicit
         TokenBuffer(const ADT::SourceBuffer &SrcBuffer,
                     std::vector<LineInfo> &&LineInfoList,
-                    std::vector<Token> &&TokenList) noexcept
+                    std::vector<Token> &&TokenList,
+                    std::vector<NumberInfo> &&NumberInfoList) noexcept
         : SrcBuffer(SrcBuffer), LineInfoList(std::move(LineInfoList)),
-          TokenList(std::move(TokenList)) {}
+          TokenList(std::move(TokenList)),
+          NumberInfoList(std::move(NumberInfoList)) {}
     public:
         static auto
         Create(const ADT::SourceBuffer &SrcBuffer,
-               DiagnosticConsumer &DiagConsumer) noexcept
+               DiagnosticConsumer &DiagConsumer,
+               TokenBufferOptions Options = TokenBufferOptions()) noexcept
             -> std::optional<TokenBuffer>;
 
+        // Lexes SrcBuffer, which is the text of Old after Edit, by lexing only
+        // from just before the edit until the tokens match Old's again.
+
+        static auto
+        CreateByEditing(const TokenBuffer &Old,
+                        const ADT::SourceBuffer &SrcBuffer,
+                        TextEdit Edit,
+                        DiagnosticConsumer &DiagConsumer) noexcept
+            -> std::optional<std::pair<TokenBuffer, TokenEdit>>;
+
         [[nodiscard]] constexpr auto &getSourceBuffer() const noexcept {
             return this->SrcBuffer;
         }
@@ -46,5 +95,8 @@ namespace Lex {
         [[nodiscard]] constexpr auto getTokenList() const noexcept {
             return std::span(this->TokenList);
         }
+
+        [[nodiscard]] auto getNumberForToken(Token Token) const noexcept
+            -> const Lex::ParseNumberResult &;
     };
 }
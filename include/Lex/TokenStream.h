@@ -30,6 +30,11 @@ namespace Lex {
             return Token.getString(this->TokenBuffer.getSourceBuffer().text());
         }
 
+        [[nodiscard]]
+        auto tokenNumber(const Lex::Token Token) const noexcept -> auto & {
+            return this->TokenBuffer.getNumberForToken(Token);
+        }
+
         [[nodiscard]]
         constexpr auto tokenKeyword(const Lex::Token Token) const noexcept {
             assert(Token.Kind == Lex::TokenKind::Keyword);
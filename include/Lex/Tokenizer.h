@@ -78,6 +78,17 @@ namespace Lex {
                   DiagnosticConsumer &DiagConsumer) noexcept
         : Text(Text), Diag(DiagConsumer), CurrentLineInfo() {}
 
+        // Start at Loc, which must be the start of a token, or the end of the
+        // last token, so the tokenizer is in its start state there.
+
+        constexpr explicit
+        Tokenizer(const std::string_view Text,
+                  DiagnosticConsumer &DiagConsumer,
+                  const SourceLocation Loc,
+                  const LineInfo CurrentLineInfo) noexcept
+        : Text(Text), Loc(Loc), Diag(DiagConsumer),
+          CurrentLineInfo(CurrentLineInfo) {}
+
         [[nodiscard]] constexpr auto getIndex() const noexcept {
             return this->Loc.Index;
         }
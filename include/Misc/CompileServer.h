@@ -0,0 +1,35 @@
+/*
+ * Misc/CompileServer.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <functional>
+#include <string_view>
+
+namespace Interface {
+    // Handles one request with the arguments the client was started with,
+    // returning the exit code to send back to the client.
+    using CompileRequestHandler =
+        std::function<int(int Argc, const char *const Argv[])>;
+
+    // Listens on the unix-domain socket at SocketPath until killed. Each
+    // request runs in a process forked from the server, so state set up
+    // before calling this is shared by every request without being set up
+    // again, but nothing a request sets up is kept for the next one. The
+    // forked process takes the client's stdin, stdout, stderr and working
+    // directory.
+
+    auto
+    RunCompileServer(std::string_view SocketPath,
+                     const CompileRequestHandler &Handler) noexcept -> int;
+
+    // Sends Argv to the server at SocketPath and waits for it to finish.
+    // Returns the exit code of the request.
+
+    auto
+    RunCompileClient(std::string_view SocketPath,
+                     int Argc,
+                     const char *const Argv[]) noexcept -> int;
+}
@@ -0,0 +1,13 @@
+/*
+ * Misc/LanguageServer.h
+ * © suhas pai
+ */
+
+#pragma once
+
+namespace Interface {
+    // Serves the language server protocol over stdin and stdout until the
+    // client sends "exit". Returns the exit code of the process.
+
+    auto RunLanguageServer() noexcept -> int;
+}
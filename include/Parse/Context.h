@@ -8,11 +8,17 @@
 #include "Diag/Consumer.h"
 #include "Lex/TokenStream.h"
 
+#include "Parse/ProbeCache.h"
+
 namespace Parse {
     struct ParseOptions {
         bool DontRequireSemicolons : 1 = false;
         bool IgnoreUnusedExpressions : 1 = false;
         bool RequireParensOnControlFlowExpr : 1 = true;
+
+        // Split large files at top-level statement boundaries and parse the
+        // pieces on worker threads.
+        bool ParseTopLevelInParallel : 1 = true;
     };
 
     struct ParseContext {
@@ -20,6 +26,7 @@ namespace Parse {
         DiagnosticConsumer &Diag;
 
         ParseOptions Options;
+        SpeculativeProbeCache ProbeCache;
 
         explicit
         ParseContext(Lex::TokenStream &TokenStream,
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "ADT/BumpAllocator.h"
+
 #include "AST/CompoundStmt.h"
 #include "AST/IfExpr.h"
 #include "AST/Qualifiers.h"
@@ -51,6 +53,45 @@ namespace Parse {
         bool RequireSeparatorInControlFlowExpr = false;
     };
 
+    // Lists are collected in a scratch buffer that is reused by every list of
+    // the same element type, then copied once into arena storage that the AST
+    // node adopts. Nested lists are pushed past the end of the outer list's
+    // elements, and removed again before the outer list continues.
+
+    template <typename T>
+    struct ScratchList {
+    protected:
+        std::vector<T> &Buffer;
+        size_t Begin;
+
+        [[nodiscard]] static auto getBuffer() noexcept -> std::vector<T> & {
+            thread_local auto Result = std::vector<T>();
+            return Result;
+        }
+    public:
+        explicit ScratchList() noexcept
+        : Buffer(getBuffer()), Begin(Buffer.size()) {}
+
+        ScratchList(const ScratchList &) = delete;
+
+        ~ScratchList() noexcept {
+            this->Buffer.erase(this->Buffer.begin() + this->Begin,
+                               this->Buffer.end());
+        }
+
+        constexpr void push(const T &Item) noexcept {
+            this->Buffer.emplace_back(Item);
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept {
+            return this->Buffer.size() == this->Begin;
+        }
+
+        [[nodiscard]] auto take() const noexcept -> std::span<T> {
+            return ADT::ArenaCopy(std::span(this->Buffer).subspan(this->Begin));
+        }
+    };
+
     template <typename T>
     [[nodiscard]] static auto
     ParseListWithSeparator(
@@ -59,13 +100,13 @@ namespace Parse {
         const std::optional<Lex::TokenKind> SeparatorTokenKindOpt,
         auto &&Parser,
         const ParseListOptions &Options) noexcept
-            -> std::expected<std::vector<T>, ParseError>
+            -> std::expected<std::span<T>, ParseError>
     {
         auto &TokenStream = Context.TokenStream;
-        auto ResultList = std::vector<T>();
+        auto ResultList = ScratchList<T>();
 
         if (TokenStream.consumeIfIsOneOf(CloseTokenKindList)) {
-            return ResultList;
+            return std::span<T>();
         }
 
         auto &Diag = Context.Diag;
@@ -104,7 +145,7 @@ namespace Parse {
                 return std::unexpected(ResultOpt.error());
             }
 
-            ResultList.emplace_back(ResultOpt.value());
+            ResultList.push(ResultOpt.value());
             if (SeparatorTokenKindOpt.has_value()) {
                 if (const auto SeparatorTokenOpt =
                         TokenStream.consumeIfIs(SeparatorTokenKindOpt.value()))
@@ -167,7 +208,7 @@ namespace Parse {
             }
         } while (true);
 
-        return ResultList;
+        return ResultList.take();
     }
 
     template <std::derived_from<AST::Stmt> T = AST::Stmt>
@@ -178,13 +219,13 @@ namespace Parse {
         const std::optional<Lex::TokenKind> SeparatorTokenKindOpt,
         auto &&Parser,
         const ParseListOptions &Options) noexcept
-            -> std::expected<std::vector<T *>, ParseError>
+            -> std::expected<std::span<T *>, ParseError>
     {
         auto &TokenStream = Context.TokenStream;
-        auto ResultList = std::vector<T *>();
+        auto ResultList = ScratchList<T *>();
 
         if (TokenStream.consumeIfIsOneOf(CloseTokenKindList)) {
-            return ResultList;
+            return std::span<T *>();
         }
 
         auto &Diag = Context.Diag;
@@ -231,7 +272,7 @@ namespace Parse {
                     return std::unexpected(IfExprOpt.error());
                 }
 
-                ResultList.emplace_back(IfExprOpt.value());
+                ResultList.push(IfExprOpt.value());
                 WasControlFlowExpr = true;
             } else {
                 const auto ExprOpt = Parser(Context);
@@ -239,7 +280,7 @@ namespace Parse {
                     return std::unexpected(ExprOpt.error());
                 }
 
-                ResultList.emplace_back(ExprOpt.value());
+                ResultList.push(ExprOpt.value());
             }
 
             if (SeparatorTokenKindOpt.has_value()) {
@@ -360,7 +401,7 @@ namespace Parse {
             return std::unexpected(ParseError::FailedCouldNotProceed);
         } while (true);
 
-        return ResultList;
+        return ResultList.take();
     }
 
     [[nodiscard]] auto
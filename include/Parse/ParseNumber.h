@@ -6,6 +6,8 @@
 #pragma once
 
 #include <string_view>
+
+#include "Lex/ParseNumber.h"
 #include "Source/SourceLocation.h"
 
 namespace AST {
@@ -13,70 +15,10 @@ namespace AST {
 }
 
 namespace Parse {
-    enum class NumberKind : uint8_t {
-        SignedInteger,
-        UnsignedInteger,
-
-        // Not yet supported
-        FloatingPoint,
-    };
-
-    enum class ParseNumberErrorKind : uint8_t {
-        None,
-        EmptyString,
-
-        NegativeNumber,
-        PositiveSign,
-
-        InvalidDigit,
-        UnrecognizedChar,
-        UnrecognizedBase,
-
-        TooLarge,
-        LeadingZero,
-        NegativeZero,
-
-        FloatingPoint,
-        Overflow,
-    };
-
-    struct ParseNumberOptions {
-        bool AllowPositiveSign : 1 = false;
-        bool DontAllowNegativeNumbers : 1 = false;
-    };
-
-    struct ParseNumberError {
-        ParseNumberErrorKind Kind;
-        union {
-            uint64_t IndexOfInvalid;
-        };
-    };
-
-    struct ParseNumberSuccessResult {
-        NumberKind Kind;
-        std::string_view Suffix;
-
-        union {
-            uint64_t UInt;
-            int64_t SInt;
-            double Float64;
-        };
-    };
-
-    struct ParseNumberResult {
-        ParseNumberError Error;
-        ParseNumberSuccessResult Success;
-    };
-
-    [[nodiscard]] auto
-    ParseNumber(std::string_view Text,
-                ParseNumberOptions Options = ParseNumberOptions()) noexcept
-        -> ParseNumberResult;
-
     [[nodiscard]] auto
     ParseNumberLiteral(
         SourceLocation Loc,
         std::string_view Text,
-        ParseNumberOptions Options = ParseNumberOptions()) noexcept
+        Lex::ParseNumberOptions Options = Lex::ParseNumberOptions()) noexcept
             -> AST::NumberLiteral *;
-}
\ No newline at end of file
+}
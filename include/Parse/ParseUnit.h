@@ -5,17 +5,35 @@
 
 #pragma once
 
+#include <memory>
+
 #include "AST/Decls/LvalueNamedDecl.h"
+#include "ADT/BumpAllocator.h"
 #include "ADT/StringMap.h"
 
 #include "Parse/Context.h"
 
 namespace Parse {
     struct ParseUnit {
+    public:
+        // The tokens [Begin, End) that a top-level statement was parsed from.
+        struct TokenRange {
+            uint32_t Begin;
+            uint32_t End;
+        };
     protected:
         std::vector<AST::Stmt *> TopLevelStmtList;
+
+        // Parallel to TopLevelStmtList.
+        std::vector<TokenRange> TopLevelStmtRangeList;
+
         ADT::UnorderedStringMap<AST::LvalueNamedDecl *> TopLevelDeclList;
 
+        // The allocators of the threads that parsed in parallel, which hold
+        // the child lists of the statements those threads parsed. They're
+        // freed with the unit.
+        std::vector<std::unique_ptr<ADT::BumpAllocator>> WorkerAllocatorList;
+
         explicit ParseUnit() noexcept = default;
     public:
         [[nodiscard]] static auto
@@ -23,14 +41,39 @@ namespace Parse {
                DiagnosticConsumer &Diag,
                ParseOptions Options) noexcept -> ParseUnit;
 
+        // Parses TokenBuffer, which was created from Old's token-buffer by
+        // Lex::TokenBuffer::CreateByEditing(). Only the statements touched by
+        // Edit are parsed again. The other statements of Old are moved into
+        // the result, and their locations are updated in place, so Old can't
+        // be used afterwards.
+
+        [[nodiscard]] static auto
+        CreateByEditing(ParseUnit &&Old,
+                        const Lex::TokenBuffer &TokenBuffer,
+                        const Lex::TokenEdit &Edit,
+                        DiagnosticConsumer &Diag,
+                        ParseOptions Options) noexcept -> ParseUnit;
+
         [[nodiscard]] constexpr auto getTopLevelStmtList() const noexcept {
             return std::span(this->TopLevelStmtList);
         }
 
+        [[nodiscard]] constexpr auto getTopLevelStmtRangeList() const noexcept {
+            return std::span(this->TopLevelStmtRangeList);
+        }
+
         [[nodiscard]] constexpr auto &getTopLevelDeclList() const noexcept {
             return this->TopLevelDeclList;
         }
 
+        // Creates an allocator for a thread parsing part of this unit.
+        [[nodiscard]] auto addWorkerAllocator() noexcept
+            -> ADT::BumpAllocator &
+        {
+            return *this->WorkerAllocatorList.emplace_back(
+                std::make_unique<ADT::BumpAllocator>());
+        }
+
         struct AddError {
             enum Code : uint32_t {
                 None,
@@ -76,7 +119,9 @@ namespace Parse {
         };
 
         [[nodiscard]]
-        auto addTopLevelStmt(AST::Stmt *const Stmt) noexcept -> AddError;
+        auto
+        addTopLevelStmt(AST::Stmt *const Stmt, TokenRange Range) noexcept
+            -> AddError;
 
         [[nodiscard]]
         auto findTopLevelDeclByName(const std::string_view Name) const noexcept
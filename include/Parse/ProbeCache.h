@@ -0,0 +1,69 @@
+/*
+ * Parse/ProbeCache.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Parse {
+    enum class ProbeKind : uint8_t {
+        ParamList,
+        ClosureParamList,
+        ClosureCaptureList,
+        SquareBracketArrayKind,
+    };
+
+    // Caches the result of speculative look-ahead, keyed by the token-stream's
+    // position when the probe started and the kind of probe. Probes only read
+    // the token-buffer, so the result at a given position never changes.
+
+    struct SpeculativeProbeCache {
+    protected:
+        std::unordered_map<uint64_t, uint64_t> ResultMap;
+
+        [[nodiscard]] constexpr static
+        auto getKey(const ProbeKind Kind, const uint32_t Position) noexcept {
+            return static_cast<uint64_t>(Position) << 8 |
+                   static_cast<uint8_t>(Kind);
+        }
+    public:
+        explicit SpeculativeProbeCache() noexcept = default;
+
+        // Returns the cached result of the probe of Kind at Position, or runs
+        // Probe and caches its result.
+
+        template <typename T>
+        auto
+        getOrRun(const ProbeKind Kind,
+                 const uint32_t Position,
+                 auto &&Probe) noexcept -> T
+        {
+            static_assert(std::is_trivially_copyable_v<T> &&
+                          sizeof(T) <= sizeof(uint64_t),
+                          "Probe result must fit in a cache entry");
+
+            const auto Key = getKey(Kind, Position);
+            if (const auto Iter = this->ResultMap.find(Key);
+                Iter != this->ResultMap.end())
+            {
+                auto Result = T();
+                std::memcpy(&Result, &Iter->second, sizeof(T));
+
+                return Result;
+            }
+
+            const T Result = Probe();
+            auto Entry = uint64_t();
+
+            std::memcpy(&Entry, &Result, sizeof(T));
+            this->ResultMap.emplace(Key, Entry);
+
+            return Result;
+        }
+    };
+}
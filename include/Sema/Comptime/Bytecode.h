@@ -0,0 +1,126 @@
+/*
+ * Sema/Comptime/Bytecode.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <string_view>
+#include <vector>
+
+#include "AST/Decls/FunctionDecl.h"
+#include "Source/SourceLocation.h"
+
+#include "Value.h"
+
+namespace Sema::Comptime {
+    // Instructions read and write registers of the running function. A
+    // function's first registers are its local slots, given out by Sema,
+    // with its parameters first. Temporaries come after them.
+
+    enum class Opcode : uint8_t {
+        // A = ConstantList[B]
+        LoadConstant,
+        // A = B
+        Move,
+        // A = B, converted to Type
+        Convert,
+
+        // A = B op C, with both operands of Type.
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Modulo,
+        Power,
+        BitwiseAnd,
+        BitwiseOr,
+        BitwiseXor,
+        LeftShift,
+        RightShift,
+        LessThan,
+        GreaterThan,
+        LessThanOrEqual,
+        GreaterThanOrEqual,
+        Equality,
+        Inequality,
+
+        // A = op B, with B of Type.
+        Negate,
+        BitwiseNot,
+        LogicalNot,
+
+        // Continue at instruction B.
+        Jump,
+        // Continue at instruction B if A is false.
+        JumpIfFalse,
+        // Continue at instruction B if A is true.
+        JumpIfTrue,
+
+        // A = CalleeList[B](C, C + 1, ...)
+        Call,
+        // Return A, or nothing if A is NoRegister.
+        Return,
+    };
+
+    constexpr static auto NoRegister = UINT32_MAX;
+
+    struct Instruction {
+        Opcode Op;
+        const BuiltinType *Type;
+
+        uint32_t A;
+        uint32_t B;
+        uint32_t C;
+    };
+
+    struct Function {
+        enum class CompileState : uint8_t {
+            NotCompiled,
+            Compiling,
+            Compiled,
+            Failed,
+        };
+
+        const AST::FunctionDecl *Decl = nullptr;
+
+        std::vector<Instruction> Code;
+
+        // Where each instruction came from, for errors found while running.
+        std::vector<SourceLocation> LocationList;
+
+        std::vector<Value> ConstantList;
+        std::vector<Function *> CalleeList;
+
+        std::vector<const BuiltinType *> ParamTypeList;
+
+        // Null until the first return statement is compiled, if the
+        // function doesn't write out its return type.
+        const BuiltinType *ReturnType = nullptr;
+
+        uint32_t RegisterCount = 0;
+        CompileState State = CompileState::NotCompiled;
+    };
+
+    // Applies a binary or unary opcode to values of type Type. Returns a
+    // message describing why, if the operation has no result.
+
+    [[nodiscard]] auto
+    ApplyBinaryOpcode(Opcode Op,
+                      const BuiltinType &Type,
+                      Value Left,
+                      Value Right) noexcept
+        -> std::expected<Value, std::string_view>;
+
+    [[nodiscard]] auto
+    ApplyUnaryOpcode(Opcode Op,
+                     const BuiltinType &Type,
+                     Value Operand) noexcept
+        -> std::expected<Value, std::string_view>;
+
+    // Converts Operand to type To. Any non-zero value converts to true.
+    [[nodiscard]]
+    auto ConvertValue(Value Operand, const BuiltinType &To) noexcept -> Value;
+}
@@ -0,0 +1,31 @@
+/*
+ * Sema/Comptime/Compiler.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include "AST/Expr.h"
+#include "Bytecode.h"
+
+namespace Sema::Comptime {
+    struct Evaluator;
+
+    // Compiles the body of Func.Decl into Func. Returns false, after
+    // reporting why, if anything in it can't be run at compile time.
+    //
+    // Values known while compiling, such as literals and the operations on
+    // them, are folded into constants, and only the branch of an if taken
+    // on a constant condition is compiled.
+
+    auto CompileFunction(Evaluator &Evaluator, Function &Func) noexcept -> bool;
+
+    // Compiles Expr into Func as a function without parameters that returns
+    // it, converted to the type TypeExpr names if TypeExpr isn't null.
+
+    auto
+    CompileExpr(Evaluator &Evaluator,
+                const AST::Expr &Expr,
+                const AST::Expr *TypeExpr,
+                Function &Func) noexcept -> bool;
+}
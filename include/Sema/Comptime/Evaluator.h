@@ -0,0 +1,139 @@
+/*
+ * Sema/Comptime/Evaluator.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "AST/Decls/VarDecl.h"
+#include "Diag/Consumer.h"
+#include "Parse/ParseUnit.h"
+
+#include "Bytecode.h"
+
+namespace Sema::Comptime {
+    // Runs code at compile time, without setting up a backend. A function is
+    // compiled to bytecode the first time it's called, and the bytecode is
+    // kept for every later call.
+    //
+    // Code run at compile time can only read its arguments, its locals and
+    // other values known at compile time, so a call's result only depends on
+    // its arguments. Results are kept for each function and list of
+    // arguments, and a call made again with the same arguments isn't run
+    // again.
+    //
+    // Names must have been resolved by Sema::ResolveNames() first.
+
+    struct Evaluator {
+    protected:
+        struct CallKeyRef {
+            const Function *Callee;
+            std::span<const Value> ArgList;
+        };
+
+        struct CallKey {
+            const Function *Callee;
+            std::vector<Value> ArgList;
+
+            [[nodiscard]] constexpr operator CallKeyRef() const noexcept {
+                return CallKeyRef {
+                    .Callee = this->Callee,
+                    .ArgList = this->ArgList
+                };
+            }
+        };
+
+        struct CallKeyHash {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            auto operator()(const CallKeyRef &Key) const noexcept -> size_t;
+        };
+
+        struct CallKeyEqual {
+            using is_transparent = void;
+
+            [[nodiscard]] auto
+            operator()(const CallKeyRef &Left,
+                       const CallKeyRef &Right) const noexcept -> bool;
+        };
+
+        enum class DeclState : uint8_t {
+            Evaluating,
+            Evaluated,
+            Failed,
+        };
+
+        struct DeclEntry {
+            DeclState State;
+            Comptime::Value Result = Comptime::Value();
+        };
+
+        DiagnosticConsumer &Diag;
+
+        std::unordered_map<const AST::FunctionDecl *,
+                           std::unique_ptr<Function>> FunctionMap;
+
+        std::unordered_map<CallKey, Value, CallKeyHash, CallKeyEqual>
+            CallResultMap;
+
+        std::unordered_map<const AST::VarDecl *, DeclEntry> DeclMap;
+
+        // Registers of every running function, each function's after its
+        // caller's.
+        std::vector<Value> RegisterStack;
+
+        uint64_t StepsLeft = 0;
+        uint32_t CallDepth = 0;
+
+        auto
+        run(const Function &Func, size_t Base) noexcept -> std::optional<Value>;
+
+        auto
+        call(const Function &Callee,
+             size_t ArgBase,
+             size_t Base,
+             SourceLocation Loc) noexcept -> std::optional<Value>;
+
+    public:
+        explicit Evaluator(DiagnosticConsumer &Diag) noexcept : Diag(Diag) {}
+
+        [[nodiscard]] constexpr auto &getDiag() const noexcept {
+            return this->Diag;
+        }
+
+        // Returns Decl compiled to bytecode, compiling it if it hasn't been.
+        // Returns null, after reporting why, if Decl can't be run at compile
+        // time.
+
+        auto getFunction(const AST::FunctionDecl &Decl) noexcept -> Function *;
+
+        // Evaluates Expr, converted to the type TypeExpr names if TypeExpr
+        // isn't null.
+
+        auto
+        evaluate(const AST::Expr &Expr,
+                 const AST::Expr *TypeExpr = nullptr) noexcept
+            -> std::optional<Value>;
+
+        // Evaluates the initializer of a top-level declaration that can't
+        // change, once. Later calls return the same value.
+
+        auto evaluateDecl(const AST::VarDecl &Decl) noexcept
+            -> std::optional<Value>;
+    };
+
+    // Evaluates every top-level comptime declaration in Unit, so errors in
+    // them are reported before any code is generated. Returns false if any
+    // couldn't be evaluated.
+
+    auto
+    EvaluateComptimeDecls(const Parse::ParseUnit &Unit,
+                          DiagnosticConsumer &Diag) noexcept -> bool;
+}
@@ -0,0 +1,21 @@
+/*
+ * Sema/Comptime/Fold.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include "Parse/ParseUnit.h"
+
+namespace Sema::Comptime {
+    // Replaces every operation in Unit whose operands are all number
+    // literals with a literal of its result, computed the way codegen would
+    // compute it, and replaces an if whose condition is such an operation
+    // with the branch it takes. Nodes are rewritten in place, so less code
+    // reaches the backend.
+    //
+    // Operations that fail, such as a division by zero, and literals that
+    // don't fit in their type are left for codegen to report.
+
+    void FoldConstants(const Parse::ParseUnit &Unit) noexcept;
+}
@@ -0,0 +1,41 @@
+/*
+ * Sema/Comptime/TypeRules.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "AST/BinaryOperation.h"
+#include "Sema/Types/Builtin.h"
+
+#include "Bytecode.h"
+
+namespace Sema::Comptime {
+    // How operands are typed, shared by codegen and compile-time evaluation,
+    // so a value computed at compile time is the value the same code computes
+    // at runtime.
+    //
+    // A number literal without a suffix takes the type of the other operand,
+    // so that "X + 1" stays a u8 add when X is a u8.
+
+    auto IsUntypedLiteral(const AST::Expr &Expr) noexcept -> bool;
+
+    auto
+    GetCommonType(const BuiltinType &Left, const BuiltinType &Right) noexcept
+        -> const BuiltinType &;
+
+    // The type both operands of BinOp are converted to before the operation.
+    auto
+    GetOperandType(const AST::BinaryOperation &BinOp,
+                   const BuiltinType &LeftType,
+                   const BuiltinType &RightType) noexcept
+        -> const BuiltinType &;
+
+    // Returns the opcode for Oper, or for the operator an assignment
+    // operator applies. Returns std::nullopt for the other operators.
+
+    auto BinaryOperatorToOpcode(Parse::BinaryOperator Oper) noexcept
+        -> std::optional<Opcode>;
+}
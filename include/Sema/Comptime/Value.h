@@ -0,0 +1,148 @@
+/*
+ * Sema/Comptime/Value.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
+#include "Sema/Types/Builtin.h"
+
+namespace Sema::Comptime {
+    // A value computed at compile time. Only builtin types are supported.
+    //
+    // Integers are kept wrapped to the width of their type, sign-extended if
+    // the type is signed, and floating-point values are kept rounded to their
+    // type, so two equal values always have equal bits. f8 has no format
+    // yet, so its values can't be rounded, and the compiler rejects it.
+
+    struct Value {
+    protected:
+        const BuiltinType *Type = &BuiltinType::voidType();
+        uint64_t Bits = 0;
+
+        constexpr explicit
+        Value(const BuiltinType &Type, const uint64_t Bits) noexcept
+        : Type(&Type), Bits(Bits) {}
+
+        [[nodiscard]] constexpr static auto
+        WrapInteger(const BuiltinType &Type, const uint64_t Bits) noexcept
+            -> uint64_t
+        {
+            const auto BitWidth = Type.getBitWidth();
+            if (BitWidth == 0 || BitWidth >= 64) {
+                return Bits;
+            }
+
+            const auto Mask = (uint64_t(1) << BitWidth) - 1;
+            if (Type.isSignedInteger() && ((Bits >> (BitWidth - 1)) & 1)) {
+                return Bits | ~Mask;
+            }
+
+            return Bits & Mask;
+        }
+
+        // Rounds to the nearest IEEE half-precision value, ties to even. The
+        // host may not have a half type, so this scales Float so that one
+        // unit in the last place of a half is 1, and rounds to an integer.
+
+        [[nodiscard]] static auto RoundToHalf(const double Float) noexcept
+            -> double
+        {
+            if (!std::isfinite(Float) || Float == 0) {
+                return Float;
+            }
+
+            // 65520 is halfway between the largest half, 65504, and 65536.
+            const auto Magnitude = std::fabs(Float);
+            if (Magnitude >= 65520) {
+                return std::copysign(INFINITY, Float);
+            }
+
+            // Halves have 10 fraction bits, and subnormals share the
+            // exponent of the smallest normal, -14.
+
+            const auto Exponent = std::max(std::ilogb(Magnitude), -14) - 10;
+            const auto Rounded =
+                std::ldexp(std::nearbyint(std::ldexp(Magnitude, -Exponent)),
+                           Exponent);
+
+            return std::copysign(Rounded, Float);
+        }
+    public:
+        explicit Value() noexcept = default;
+
+        [[nodiscard]] constexpr static
+        auto Integer(const BuiltinType &Type, const uint64_t Bits) noexcept {
+            return Value(Type, WrapInteger(Type, Bits));
+        }
+
+        [[nodiscard]] static auto
+        FloatingPoint(const BuiltinType &Type, const double Float) noexcept {
+            if (Type.getBitWidth() == 32) {
+                return Value(Type,
+                             std::bit_cast<uint64_t>(
+                                static_cast<double>(
+                                    static_cast<float>(Float))));
+            }
+
+            if (Type.getBitWidth() == 16) {
+                return Value(Type, std::bit_cast<uint64_t>(RoundToHalf(Float)));
+            }
+
+            return Value(Type, std::bit_cast<uint64_t>(Float));
+        }
+
+        [[nodiscard]] static auto Bool(const bool Bool) noexcept {
+            return Value(BuiltinType::boolType(), Bool);
+        }
+
+        [[nodiscard]] constexpr auto &getType() const noexcept {
+            return *this->Type;
+        }
+
+        [[nodiscard]] constexpr auto getBits() const noexcept {
+            return this->Bits;
+        }
+
+        [[nodiscard]] constexpr auto asUInt() const noexcept {
+            return this->Bits;
+        }
+
+        [[nodiscard]] constexpr auto asSInt() const noexcept {
+            return static_cast<int64_t>(this->Bits);
+        }
+
+        [[nodiscard]] constexpr auto asFloat() const noexcept {
+            return std::bit_cast<double>(this->Bits);
+        }
+
+        // Any non-zero value is true.
+        [[nodiscard]] auto isTrue() const noexcept -> bool {
+            if (this->Type->isFloatingPoint()) {
+                return this->asFloat() != 0;
+            }
+
+            return this->Bits != 0;
+        }
+
+        [[nodiscard]]
+        constexpr auto operator==(const Value &Other) const noexcept {
+            return this->Type == Other.Type && this->Bits == Other.Bits;
+        }
+    };
+}
+
+template <>
+struct std::hash<Sema::Comptime::Value> {
+    [[nodiscard]] auto
+    operator()(const Sema::Comptime::Value &Value) const noexcept -> size_t {
+        return std::hash<uint64_t>()(Value.getBits()) ^
+               std::hash<const void *>()(&Value.getType());
+    }
+};
@@ -0,0 +1,72 @@
+/*
+ * Sema/DependencyGraph.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ADT/StringMap.h"
+#include "AST/DeclRefExpr.h"
+
+namespace Sema {
+    // Records the top-level names each top-level statement declares and
+    // uses, so that after an edit only the statements the edit can affect
+    // are checked again.
+    //
+    // Statements are linked through names rather than declarations: a
+    // declaration that is parsed again is a new node, and an edit may declare
+    // a name that a statement used before it was declared.
+
+    struct DependencyGraph {
+    public:
+        struct Node {
+            std::vector<std::string> DeclaredNameList;
+
+            // Names used by the statement that aren't declared inside it.
+            std::vector<std::string> UsedNameList;
+
+            // Every name reference inside the statement, so a reference can
+            // be found by its location without walking the statement.
+            std::vector<AST::DeclRefExpr *> DeclRefList;
+        };
+    protected:
+        std::unordered_map<const AST::Stmt *, Node> NodeMap;
+
+        // The statements that declare or use each name.
+        ADT::UnorderedStringMap<std::vector<const AST::Stmt *>> UserListMap;
+    public:
+        explicit DependencyGraph() noexcept = default;
+
+        // Replaces what was recorded for Stmt, if anything.
+        auto setNode(const AST::Stmt &Stmt, Node &&Node) noexcept
+            -> decltype(*this);
+
+        auto removeNode(const AST::Stmt &Stmt) noexcept -> decltype(*this);
+
+        [[nodiscard]] auto getNode(const AST::Stmt &Stmt) const noexcept
+            -> const Node *;
+
+        [[nodiscard]] auto contains(const AST::Stmt &Stmt) const noexcept {
+            return this->NodeMap.contains(&Stmt);
+        }
+
+        [[nodiscard]] constexpr auto &getNodeMap() const noexcept {
+            return this->NodeMap;
+        }
+
+        // Returns every statement that declares or uses a name in NameList,
+        // then every statement that declares or uses a name those declare,
+        // and so on.
+
+        [[nodiscard]] auto
+        collectDependents(std::span<const std::string> NameList) const noexcept
+            -> std::vector<const AST::Stmt *>;
+
+        auto clear() noexcept -> decltype(*this);
+    };
+}
@@ -4,9 +4,10 @@
  */
 
 #pragma once
+#include <cstdint>
 
 namespace Sema {
-    enum class InlinePolicy {
+    enum class InlinePolicy : uint8_t {
         None,
         Default,
         DontInline,
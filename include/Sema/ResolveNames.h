@@ -0,0 +1,53 @@
+/*
+ * Sema/ResolveNames.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Diag/Consumer.h"
+#include "Parse/ParseUnit.h"
+#include "Sema/DependencyGraph.h"
+
+namespace Sema {
+    // Points every DeclRefExpr in Unit at the declaration it names, so later
+    // stages don't have to look names up again. Top-level declarations are
+    // visible everywhere, even before they're declared.
+    //
+    // Each local declaration of a function is also given a slot, so codegen
+    // can keep the values of locals in an array instead of looking them up
+    // by name.
+    //
+    // Top-level statements of units with many functions are resolved on
+    // several threads. Messages are still consumed in source order, on the
+    // calling thread.
+    //
+    // Names in type expressions that aren't declared are left unresolved, as
+    // they may name builtin or struct types, which aren't declarations.
+    // Returns false if any other name isn't declared, or is declared twice in
+    // one scope.
+    //
+    // If Graph isn't null, it's cleared, then filled with the names each
+    // top-level statement declares and uses.
+
+    auto ResolveNames(const Parse::ParseUnit &Unit,
+                      DiagnosticConsumer &Diag,
+                      DependencyGraph *Graph = nullptr) noexcept -> bool;
+
+    // Resolves only what an edit could have changed. Graph must have been
+    // filled for the unit Unit was edited from. The statements Graph has no
+    // node for, which are new or were parsed again, are resolved, along with
+    // every statement that depends on a name they declare, or that a removed
+    // statement declared, directly or through other statements.
+    //
+    // Returns the statements that were resolved, in source order. Messages
+    // of other statements still apply.
+
+    auto
+    ResolveChangedNames(const Parse::ParseUnit &Unit,
+                        DependencyGraph &Graph,
+                        DiagnosticConsumer &Diag) noexcept
+        -> std::vector<AST::Stmt *>;
+}
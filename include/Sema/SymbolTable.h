@@ -1,34 +1,67 @@
 /*
  * Sema/SymbolTable.h
+ * © suhas pai
  */
 
 #pragma once
 
-#include <span>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 #include <vector>
 
 #include "ADT/StringMap.h"
-#include "Sema/Scope.h"
+#include "AST/Stmt.h"
 
 namespace Sema {
+    // Every name visible at one point of a function, in one hash table. A
+    // declaration that shadows another one saves the one it hides in the undo
+    // log, which puts it back when the scope is popped. A lookup is then one
+    // probe however deeply scopes are nested.
+    //
+    // Names are views of the strings in declarations, so declarations must
+    // outlive the table.
+
     struct SymbolTable {
     protected:
-        std::vector<Scope *> ScopeList;
+        struct Entry {
+            AST::Stmt *Decl;
+
+            // Number of scopes open when the declaration was added.
+            uint32_t Depth;
+        };
+
+        struct UndoEntry {
+            std::string_view Name;
+            std::optional<Entry> Shadowed;
+        };
+
+        ADT::UnorderedStringViewMap<Entry> Map;
+        std::vector<UndoEntry> UndoLog;
+
+        // Size of the undo log when each open scope was pushed.
+        std::vector<size_t> ScopeStartList;
     public:
-        explicit SymbolTable() noexcept;
+        explicit SymbolTable() noexcept = default;
 
-        constexpr explicit
-        SymbolTable(const std::span<Scope *> ScopeList) noexcept
-        : ScopeList(ScopeList.begin(), ScopeList.end()) {}
+        void pushScope() noexcept;
 
-        constexpr explicit
-        SymbolTable(std::vector<Scope *> &&ScopeList) noexcept
-        : ScopeList(std::move(ScopeList)) {}
+        // Removes every declaration of the innermost scope, and brings back
+        // the declarations they shadowed.
+        void popScope() noexcept;
 
-        [[nodiscard]] constexpr auto &getGlobalScope() const noexcept {
-            return *ScopeList.front();
-        }
+        // Adds Decl to the innermost scope under Name. If that scope already
+        // declares Name, nothing is added and the earlier declaration is
+        // returned.
+
+        auto addDecl(std::string_view Name, AST::Stmt &Decl) noexcept
+            -> AST::Stmt *;
 
-        auto addScope(Scope *Scope) noexcept -> bool;
+        [[nodiscard]] auto lookup(std::string_view Name) const noexcept
+            -> AST::Stmt *;
+
+        [[nodiscard]] constexpr auto getDepth() const noexcept {
+            return static_cast<uint32_t>(this->ScopeStartList.size());
+        }
     };
 }
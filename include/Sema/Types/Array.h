@@ -0,0 +1,50 @@
+/*
+ * Sema/Types/Array.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <optional>
+#include "Type.h"
+
+namespace Sema {
+    struct ArrayType : public Type {
+    public:
+        constexpr static auto TyKind = TypeKind::Array;
+    protected:
+        Type *ElementType;
+        std::optional<uint64_t> Length;
+
+        std::string_view Name;
+    public:
+        constexpr explicit
+        ArrayType(Type *const ElementType,
+                  const std::optional<uint64_t> Length,
+                  const std::string_view Name) noexcept
+        : Type(TyKind), ElementType(ElementType), Length(Length), Name(Name) {}
+
+        [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
+            return Ty.getKind() == TyKind;
+        }
+
+        [[nodiscard]]
+        constexpr static auto classof(const Type *const Type) noexcept {
+            return IsOfKind(*Type);
+        }
+
+        [[nodiscard]] constexpr auto getElementType() const noexcept {
+            return this->ElementType;
+        }
+
+        // Arrays with no length have their length decided at runtime.
+        [[nodiscard]] constexpr auto getLength() const noexcept {
+            return this->Length;
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view getName() const noexcept override {
+            return this->Name;
+        }
+    };
+}
@@ -5,18 +5,35 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+
+#include "ADT/StringMap.h"
 #include "Type.h"
 
 namespace Sema {
     struct BuiltinType : public Type {
     public:
         constexpr static auto TyKind = TypeKind::Builtin;
+
+        enum class Category : uint8_t {
+            Void,
+            UnsignedInteger,
+            SignedInteger,
+            FloatingPoint,
+            Bool,
+        };
     protected:
         std::string Name;
 
-        constexpr explicit BuiltinType(std::string_view Name) noexcept
-        : Type(TypeKind::Builtin), Name(Name) {}
+        Category Cat;
+        uint8_t BitWidth;
+
+        constexpr explicit
+        BuiltinType(const std::string_view Name,
+                    const Category Cat,
+                    const uint8_t BitWidth) noexcept
+        : Type(TypeKind::Builtin), Name(Name), Cat(Cat), BitWidth(BitWidth) {}
     public:
         [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
             return Ty.getKind() == TyKind;
@@ -28,72 +45,82 @@ namespace Sema {
         }
 
         [[nodiscard]] static auto voidType() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("void");
+            static auto Result = BuiltinType("void", Category::Void, 0);
             return Result;
         }
 
         [[nodiscard]] static auto u8() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("u8");
+            static auto Result =
+                BuiltinType("u8", Category::UnsignedInteger, 8);
             return Result;
         }
 
         [[nodiscard]] static auto u16() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("u16");
+            static auto Result =
+                BuiltinType("u16", Category::UnsignedInteger, 16);
             return Result;
         }
 
         [[nodiscard]] static auto u32() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("u32");
+            static auto Result =
+                BuiltinType("u32", Category::UnsignedInteger, 32);
             return Result;
         }
 
         [[nodiscard]] static auto u64() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("u64");
+            static auto Result =
+                BuiltinType("u64", Category::UnsignedInteger, 64);
             return Result;
         }
 
         [[nodiscard]] static auto s8() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("s8");
+            static auto Result = BuiltinType("s8", Category::SignedInteger, 8);
             return Result;
         }
 
         [[nodiscard]] static auto s16() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("s16");
+            static auto Result =
+                BuiltinType("s16", Category::SignedInteger, 16);
             return Result;
         }
 
         [[nodiscard]] static auto s32() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("s32");
+            static auto Result =
+                BuiltinType("s32", Category::SignedInteger, 32);
             return Result;
         }
 
         [[nodiscard]] static auto s64() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("s64");
+            static auto Result =
+                BuiltinType("s64", Category::SignedInteger, 64);
             return Result;
         }
 
         [[nodiscard]] static auto f8() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("f8");
+            static auto Result = BuiltinType("f8", Category::FloatingPoint, 8);
             return Result;
         }
 
         [[nodiscard]] static auto f16() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("f16");
+            static auto Result =
+                BuiltinType("f16", Category::FloatingPoint, 16);
             return Result;
         }
 
         [[nodiscard]] static auto f32() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("f32");
+            static auto Result =
+                BuiltinType("f32", Category::FloatingPoint, 32);
             return Result;
         }
 
         [[nodiscard]] static auto f64() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("f64");
+            static auto Result =
+                BuiltinType("f64", Category::FloatingPoint, 64);
             return Result;
         }
 
         [[nodiscard]] static auto boolType() noexcept -> BuiltinType & {
-            static auto Result = BuiltinType("bool");
+            static auto Result = BuiltinType("bool", Category::Bool, 1);
             return Result;
         }
 
@@ -102,64 +129,59 @@ namespace Sema {
             return Name;
         }
 
-        [[nodiscard]]
-        constexpr static auto forName(const std::string_view Name) noexcept
-            -> BuiltinType *
-        {
-            if (Name == "void") {
-                return &voidType();
-            }
-
-            if (Name == "u8") {
-                return &u8();
-            }
-
-            if (Name == "u16") {
-                return &u16();
-            }
-
-            if (Name == "u32") {
-                return &u32();
-            }
-
-            if (Name == "u64") {
-                return &u64();
-            }
-
-            if (Name == "s8") {
-                return &s8();
-            }
-
-            if (Name == "s16") {
-                return &s16();
-            }
+        [[nodiscard]] constexpr auto getCategory() const noexcept {
+            return this->Cat;
+        }
 
-            if (Name == "s32") {
-                return &s32();
-            }
+        // Size of the type in bits. Zero for void, one for bool.
+        [[nodiscard]] constexpr auto getBitWidth() const noexcept {
+            return this->BitWidth;
+        }
 
-            if (Name == "s64") {
-                return &s64();
-            }
+        [[nodiscard]] constexpr auto isInteger() const noexcept {
+            return this->Cat == Category::UnsignedInteger ||
+                   this->Cat == Category::SignedInteger;
+        }
 
-            if (Name == "f8") {
-                return &f8();
-            }
+        [[nodiscard]] constexpr auto isSignedInteger() const noexcept {
+            return this->Cat == Category::SignedInteger;
+        }
 
-            if (Name == "f16") {
-                return &f16();
-            }
+        [[nodiscard]] constexpr auto isFloatingPoint() const noexcept {
+            return this->Cat == Category::FloatingPoint;
+        }
 
-            if (Name == "f32") {
-                return &f32();
-            }
+        [[nodiscard]] constexpr auto isBool() const noexcept {
+            return this->Cat == Category::Bool;
+        }
 
-            if (Name == "f64") {
-                return &f64();
-            }
+        [[nodiscard]] constexpr auto isVoid() const noexcept {
+            return this->Cat == Category::Void;
+        }
 
-            if (Name == "bool") {
-                return &boolType();
+        [[nodiscard]]
+        static auto forName(const std::string_view Name) noexcept
+            -> BuiltinType *
+        {
+            static const auto Map = ADT::UnorderedStringViewMap<BuiltinType *>({
+                { "void", &voidType() },
+                { "u8", &u8() },
+                { "u16", &u16() },
+                { "u32", &u32() },
+                { "u64", &u64() },
+                { "s8", &s8() },
+                { "s16", &s16() },
+                { "s32", &s32() },
+                { "s64", &s64() },
+                { "f8", &f8() },
+                { "f16", &f16() },
+                { "f32", &f32() },
+                { "f64", &f64() },
+                { "bool", &boolType() },
+            });
+
+            if (const auto Iter = Map.find(Name); Iter != Map.end()) {
+                return Iter->second;
             }
 
             return nullptr;
@@ -0,0 +1,144 @@
+/*
+ * Sema/Types/Context.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "ADT/BumpAllocator.h"
+
+#include "Sema/Types/Array.h"
+#include "Sema/Types/Builtin.h"
+#include "Sema/Types/FunctionProtoype.h"
+#include "Sema/Types/Optional.h"
+#include "Sema/Types/Pointer.h"
+#include "Sema/Types/PointerQualifiers.h"
+#include "Sema/Types/QualifiedTable.h"
+#include "Sema/Types/Struct.h"
+#include "Sema/Types/UnionOf.h"
+
+namespace Sema {
+    // Creates and owns every type of a compilation. Structural types are
+    // hash-consed: asking for the same type twice returns the same object, so
+    // two types are equal only if they're the same pointer. Struct types are
+    // nominal, so each one is created anew.
+    //
+    // Types are allocated from the context's arena and are never destroyed,
+    // like AST nodes.
+
+    struct TypeContext {
+    protected:
+        struct PointerKey {
+            Type *PointeeType;
+            uint8_t QualBits;
+
+            [[nodiscard]]
+            constexpr bool operator==(const PointerKey &) const = default;
+        };
+
+        struct ArrayKey {
+            Type *ElementType;
+            std::optional<uint64_t> Length;
+
+            [[nodiscard]]
+            constexpr bool operator==(const ArrayKey &) const = default;
+        };
+
+        struct FunctionKey {
+            QualifiedType *ReturnType;
+            std::vector<QualifiedType *> ParamList;
+
+            [[nodiscard]]
+            constexpr bool operator==(const FunctionKey &) const = default;
+        };
+
+        struct KeyHash {
+            [[nodiscard]]
+            auto operator()(const PointerKey &Key) const noexcept -> size_t;
+
+            [[nodiscard]]
+            auto operator()(const ArrayKey &Key) const noexcept -> size_t;
+
+            [[nodiscard]]
+            auto operator()(const FunctionKey &Key) const noexcept -> size_t;
+
+            [[nodiscard]] auto
+            operator()(const std::vector<Type *> &Key) const noexcept
+                -> size_t;
+        };
+
+        ADT::BumpAllocator Allocator;
+        QualifiedTypeTable QualifiedTable;
+
+        std::unordered_map<PointerKey, PointerType *, KeyHash> PointerMap;
+        std::unordered_map<ArrayKey, ArrayType *, KeyHash> ArrayMap;
+        std::unordered_map<Type *, OptionalType *> OptionalMap;
+        std::unordered_map<FunctionKey, FunctionPrototype *, KeyHash>
+            FunctionMap;
+
+        // Keyed on the sorted list of members.
+        std::unordered_map<std::vector<Type *>, UnionOfType *, KeyHash>
+            UnionOfMap;
+
+        template <typename T, typename... ArgTypes>
+        [[nodiscard]] auto create(ArgTypes &&...Args) noexcept -> T & {
+            return this->Allocator.create<T>(std::forward<ArgTypes>(Args)...);
+        }
+    public:
+        explicit TypeContext() noexcept = default;
+
+        TypeContext(const TypeContext &) = delete;
+        auto operator=(const TypeContext &) = delete;
+
+        // Builtin types are shared by every context.
+        [[nodiscard]]
+        static auto getBuiltinType(const std::string_view Name) noexcept {
+            return BuiltinType::forName(Name);
+        }
+
+        [[nodiscard]]
+        auto getQualifiedType(Type &Ty, TypeQualifiers Quals) noexcept
+            -> QualifiedType &;
+
+        [[nodiscard]] auto
+        getPointerType(Type &PointeeType,
+                       PointerBaseTypeQualifiers Quals) noexcept
+            -> PointerType &;
+
+        [[nodiscard]] auto
+        getArrayType(Type &ElementType,
+                     std::optional<uint64_t> Length) noexcept -> ArrayType &;
+
+        [[nodiscard]] auto getOptionalType(Type &BaseType) noexcept
+            -> OptionalType &;
+
+        [[nodiscard]] auto
+        getFunctionPrototype(QualifiedType &ReturnType,
+                             std::span<QualifiedType *const> ParamList) noexcept
+            -> FunctionPrototype &;
+
+        // Members that are themselves unions are flattened, and duplicates are
+        // dropped, so "u32 or (u64 or u32)" is "u32 or u64". A union of a
+        // single type is that type.
+
+        [[nodiscard]]
+        auto getUnionOfType(std::span<Type *const> MemberList) noexcept
+            -> Type &;
+
+        // The name and fields of a struct are copied into the context, so
+        // they don't have to outlive the source they came from.
+
+        [[nodiscard]] auto createStructType(std::string_view Name) noexcept
+            -> StructType &;
+
+        auto
+        completeStructType(StructType &Struct,
+                           std::span<const StructType::Field> FieldList)
+            noexcept -> StructType &;
+    };
+}
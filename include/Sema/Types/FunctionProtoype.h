@@ -6,7 +6,6 @@
 #pragma once
 
 #include <span>
-#include <vector>
 
 #include "Sema/Types/Qualified.h"
 
@@ -16,19 +15,17 @@ namespace Sema {
         constexpr static auto ObjKind = TypeKind::FunctionPrototype;
     protected:
         QualifiedType *ReturnType;
-        std::vector<QualifiedType *> ParamList;
-    public:
-        constexpr explicit
-        FunctionPrototype(QualifiedType *const ReturnType,
-                          const std::span<QualifiedType *> ParamList) noexcept
-        : Type(ObjKind), ReturnType(ReturnType),
-          ParamList(ParamList.begin(), ParamList.end()) {}
 
+        // Both are owned by the TypeContext that created the prototype.
+        std::span<QualifiedType *const> ParamList;
+        std::string_view Name;
+    public:
         constexpr explicit
         FunctionPrototype(QualifiedType *const ReturnType,
-                          std::vector<QualifiedType *> &&ParamList) noexcept
-        : Type(ObjKind), ReturnType(ReturnType),
-          ParamList(std::move(ParamList)) {}
+                          const std::span<QualifiedType *const> ParamList,
+                          const std::string_view Name) noexcept
+        : Type(ObjKind), ReturnType(ReturnType), ParamList(ParamList),
+          Name(Name) {}
 
         [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
             return Ty.getKind() == ObjKind;
@@ -44,11 +41,12 @@ namespace Sema {
         }
 
         [[nodiscard]] constexpr auto getParamList() const noexcept {
-            return std::span(this->ParamList);
+            return this->ParamList;
         }
 
-        [[nodiscard]] constexpr auto &getParamListRef() noexcept {
-            return this->ParamList;
+        [[nodiscard]]
+        constexpr std::string_view getName() const noexcept override {
+            return this->Name;
         }
     };
 }
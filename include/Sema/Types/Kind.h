@@ -9,8 +9,11 @@ namespace Sema {
     enum class TypeKind {
         Builtin,
         Pointer,
+        Array,
+        Optional,
         Structure,
         Union,
+        UnionOf,
         FunctionPrototype,
         Enum
     };
@@ -0,0 +1,82 @@
+/*
+ * Sema/Types/Layout.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Sema/Types/Struct.h"
+
+namespace llvm {
+    class DataLayout;
+}
+
+namespace Sema {
+    // How a value of a type is laid out in memory, in bytes. Size is padded
+    // to a multiple of Alignment, so it's also the distance between the
+    // elements of an array.
+
+    struct TypeLayout {
+        uint64_t Size = 0;
+        uint64_t Alignment = 1;
+
+        // Offset of each field of a struct, in the order the fields are
+        // declared. Empty for other types.
+        std::vector<uint64_t> FieldOffsetList;
+
+        // Index of each field of a struct, in the order the fields are placed
+        // in memory. Lowering a struct to a target type has to list its
+        // members in this order for the offsets to hold.
+        std::vector<uint32_t> FieldOrder;
+    };
+
+    // Computes the layout of types for a target, and keeps it so each type
+    // is only laid out once. Builtin types and pointers take their size and
+    // alignment from the target's data layout; the rest are built up from
+    // them.
+    //
+    // An optional is its base type followed by a bool. A union of types is
+    // storage for its largest member followed by a tag, the smallest
+    // unsigned integer that can number every member.
+
+    struct LayoutContext {
+    protected:
+        enum class LayoutState : uint8_t {
+            Computing,
+            Computed,
+        };
+
+        struct LayoutEntry {
+            LayoutState State;
+            TypeLayout Layout;
+        };
+
+        std::unordered_map<const Type *, LayoutEntry> LayoutMap;
+        TypeLayout PointerLayout;
+
+        [[nodiscard]]
+        auto computeStructLayout(const StructType &Struct) noexcept
+            -> std::optional<TypeLayout>;
+
+        [[nodiscard]] auto computeLayout(const Type &Ty) noexcept
+            -> std::optional<TypeLayout>;
+    public:
+        explicit LayoutContext(const llvm::DataLayout &DL) noexcept;
+
+        LayoutContext(const LayoutContext &) = delete;
+        auto operator=(const LayoutContext &) = delete;
+
+        // Returns null for types without a size known at compile time, which
+        // are arrays without a length, structs that contain themselves or
+        // aren't complete, and types that contain any of them, as well as
+        // arrays too large to have a size.
+
+        [[nodiscard]] auto getLayout(const Type &Ty) noexcept
+            -> const TypeLayout *;
+    };
+}
@@ -0,0 +1,39 @@
+/*
+ * Sema/Types/Optional.h
+ * © suhas pai
+ */
+
+#pragma once
+#include "Type.h"
+
+namespace Sema {
+    struct OptionalType : public Type {
+    public:
+        constexpr static auto TyKind = TypeKind::Optional;
+    protected:
+        Type *BaseType;
+        std::string_view Name;
+    public:
+        constexpr explicit
+        OptionalType(Type *const BaseType, const std::string_view Name) noexcept
+        : Type(TyKind), BaseType(BaseType), Name(Name) {}
+
+        [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
+            return Ty.getKind() == TyKind;
+        }
+
+        [[nodiscard]]
+        constexpr static auto classof(const Type *const Type) noexcept {
+            return IsOfKind(*Type);
+        }
+
+        [[nodiscard]] constexpr auto getBaseType() const noexcept {
+            return this->BaseType;
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view getName() const noexcept override {
+            return this->Name;
+        }
+    };
+}
@@ -4,6 +4,8 @@
  */
 
 #pragma once
+
+#include "PointerQualifiers.h"
 #include "Type.h"
 
 namespace Sema {
@@ -12,9 +14,16 @@ namespace Sema {
         constexpr static auto TyKind = TypeKind::Pointer;
     protected:
         Type *PointeeType;
+        PointerBaseTypeQualifiers Quals;
+
+        std::string_view Name;
     public:
-        constexpr explicit PointerType(Type *const PointeeType) noexcept
-        : Type(TypeKind::Pointer), PointeeType(PointeeType) {}
+        constexpr explicit
+        PointerType(Type *const PointeeType,
+                    const PointerBaseTypeQualifiers Quals,
+                    const std::string_view Name) noexcept
+        : Type(TypeKind::Pointer), PointeeType(PointeeType), Quals(Quals),
+          Name(Name) {}
 
         [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
             return Ty.getKind() == TyKind;
@@ -29,9 +38,13 @@ namespace Sema {
             return this->PointeeType;
         }
 
+        [[nodiscard]] constexpr auto getQualifiers() const noexcept {
+            return this->Quals;
+        }
+
         [[nodiscard]]
         constexpr std::string_view getName() const noexcept override {
-            return this->PointeeType->getName();
+            return this->Name;
         }
     };
 }
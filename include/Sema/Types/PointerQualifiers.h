@@ -4,11 +4,18 @@
  */
 
 #pragma once
+#include <cstdint>
 
 namespace Sema {
     struct PointerBaseTypeQualifiers {
         bool isMutable : 1 = false;
         bool isVolatile : 1 = false;
         bool isUnaliased : 1 = false;
+
+        [[nodiscard]] constexpr auto getBits() const noexcept -> uint8_t {
+            return static_cast<uint8_t>(this->isMutable |
+                                        this->isVolatile << 1 |
+                                        this->isUnaliased << 2);
+        }
     };
 }
@@ -21,7 +21,7 @@ namespace Sema {
             return this->TyAndBits.getPointer();
         }
 
-        [[nodiscard]] auto getQualifiers() const noexcept {
+        [[nodiscard]] constexpr auto getQualifiers() const noexcept {
             return TypeQualifiers(this->TyAndBits.getBits());
         }
 
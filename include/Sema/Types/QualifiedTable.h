@@ -11,11 +11,13 @@
 
 namespace Sema {
     // Create a central table for AST::QualifiedType. This allows canonical
-    // types to be looked up in O(1) rather than O(n).
+    // types to be looked up in O(1) rather than O(n). Entries are keyed on
+    // both the type and its qualifiers, packed together the same way
+    // QualifiedType packs them.
 
     class QualifiedTypeTable {
     protected:
-        std::unordered_map<Type *, QualifiedType> Table;
+        std::unordered_map<uintptr_t, QualifiedType> Table;
     public:
         explicit QualifiedTypeTable() noexcept = default;
 
@@ -5,9 +5,9 @@
 
 #pragma once
 
-#include <string>
+#include <cassert>
 #include <span>
-#include <vector>
+#include <string_view>
 
 #include "Qualified.h"
 
@@ -16,19 +16,26 @@ namespace Sema {
     public:
         constexpr static auto TyKind = TypeKind::Structure;
         struct Field {
-            std::string Name;
+            std::string_view Name;
             QualifiedType *Type;
         };
     protected:
-        std::string Name;
-        std::vector<Field *> FieldList;
+        // Both are owned by the TypeContext that created the struct.
+        std::string_view Name;
+        std::span<Field> FieldList;
+
+        // Fields are only set once, when the struct is complete, and only a
+        // complete struct has a layout, so a layout is never out of date.
+        bool IsComplete : 1 = false;
+
+        // Whether the fields may be laid out in another order than the one
+        // they're declared in, so that less padding is needed. Set by the
+        // @reorder attribute.
+        bool ReordersFields : 1 = false;
     public:
         constexpr explicit StructType(const std::string_view Name) noexcept
         : Type(TypeKind::Structure), Name(Name) {}
 
-        constexpr explicit StructType(std::string &&Name) noexcept
-        : Type(TypeKind::Structure), Name(std::move(Name)) {}
-
         [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
             return Ty.getKind() == TyKind;
         }
@@ -44,11 +51,38 @@ namespace Sema {
         }
 
         [[nodiscard]] constexpr auto getFieldList() const noexcept {
-            return std::span(this->FieldList);
+            return std::span<const Field>(this->FieldList);
+        }
+
+        [[nodiscard]] constexpr auto isComplete() const noexcept {
+            return this->IsComplete;
+        }
+
+        [[nodiscard]] constexpr auto reordersFields() const noexcept {
+            return this->ReordersFields;
         }
 
-        [[nodiscard]] constexpr auto &getFieldListRef() noexcept {
-            return this->FieldList;
+        // Like the fields, the order is part of the layout, so it can't
+        // change once the struct is complete.
+
+        constexpr auto setReordersFields(const bool Value) noexcept
+            -> decltype(*this)
+        {
+            assert(!this->IsComplete && "Struct is already complete");
+
+            this->ReordersFields = Value;
+            return *this;
+        }
+
+        constexpr auto complete(const std::span<Field> FieldList) noexcept
+            -> decltype(*this)
+        {
+            assert(!this->IsComplete && "Struct is already complete");
+
+            this->FieldList = FieldList;
+            this->IsComplete = true;
+
+            return *this;
         }
     };
 }
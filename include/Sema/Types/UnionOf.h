@@ -0,0 +1,44 @@
+/*
+ * Sema/Types/UnionOf.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <span>
+#include "Type.h"
+
+namespace Sema {
+    // A value of any one of several types, written as "u32 or u64".
+
+    struct UnionOfType : public Type {
+    public:
+        constexpr static auto TyKind = TypeKind::UnionOf;
+    protected:
+        std::span<Type *> MemberList;
+        std::string_view Name;
+    public:
+        constexpr explicit
+        UnionOfType(const std::span<Type *> MemberList,
+                    const std::string_view Name) noexcept
+        : Type(TyKind), MemberList(MemberList), Name(Name) {}
+
+        [[nodiscard]] constexpr static auto IsOfKind(const Type &Ty) noexcept {
+            return Ty.getKind() == TyKind;
+        }
+
+        [[nodiscard]]
+        constexpr static auto classof(const Type *const Type) noexcept {
+            return IsOfKind(*Type);
+        }
+
+        [[nodiscard]] constexpr auto getMemberList() const noexcept {
+            return this->MemberList;
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view getName() const noexcept override {
+            return this->Name;
+        }
+    };
+}
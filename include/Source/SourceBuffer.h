@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstdlib>
+#include <cstring>
 #include <expected>
 #include <string>
 
@@ -15,7 +17,9 @@ namespace ADT {
             enum class Kind : uint8_t {
                 FailedToOpenFile,
                 FailedToStatFile,
-                FailedToMapFile
+                FailedToMapFile,
+                FailedToReadFile,
+                FailedToAssignLocations,
             };
 
             Kind Kind;
@@ -45,14 +49,29 @@ namespace ADT {
         [[nodiscard]] static auto FromFile(const std::string_view Path) noexcept
             -> std::expected<SourceBuffer *, Error>;
 
+        // Maps the first Size bytes of the file open at Fd. With Populate,
+        // the file is read in before returning, instead of on first access.
+        // Fd can be closed afterwards.
+
+        [[nodiscard]] static auto
+        FromFileDescriptor(int Fd, size_t Size, bool Populate) noexcept
+            -> std::expected<SourceBuffer *, Error>;
+
+        // Memory owned by someone else, which must outlive the buffer.
+        [[nodiscard]] static auto
+        FromUnownedMemory(const void *Base, size_t Size) noexcept
+            -> SourceBuffer *;
+
         [[nodiscard]] static auto FromAlloc(void *Base, size_t Size) noexcept
             -> SourceBuffer *;
 
         [[nodiscard]] static
         auto FromString(const std::string_view Text) noexcept -> SourceBuffer *
         {
-            const auto Copy = new char[Text.length() + 1]{0};
+            // Allocated buffers are freed with free().
+            const auto Copy = static_cast<char *>(malloc(Text.length() + 1));
             memcpy(Copy, Text.data(), Text.length());
+            Copy[Text.length()] = '\0';
 
             return FromAlloc(Copy, Text.length());
         }
@@ -6,6 +6,15 @@
 #pragma once
 #include <cstdint>
 
+// How far text moved after an edit to the buffer before it. Columns are
+// unchanged, as text is only moved whole lines at a time, or within a line
+// that is otherwise unedited.
+
+struct SourceLocationShift {
+    int32_t Index = 0;
+    int32_t Row = 0;
+};
+
 struct SourceLocation {
     constexpr static auto RowLimit = (1 << 20) - 1;
     constexpr static auto ColumnLimit = (1 << 12) - 1;
@@ -30,6 +39,15 @@ struct SourceLocation {
         };
     }
 
+    [[nodiscard]]
+    constexpr auto shifted(const SourceLocationShift Shift) const noexcept {
+        return SourceLocation {
+            .Index = static_cast<uint32_t>(this->Index + Shift.Index),
+            .Row = static_cast<uint32_t>(this->Row + Shift.Row),
+            .Column = this->Column
+        };
+    }
+
     [[nodiscard]]
     constexpr auto adding(const uint16_t Offset) const noexcept {
         return SourceLocation {
@@ -0,0 +1,134 @@
+/*
+ * Source/SourceManager.h
+ * © suhas pai
+ */
+
+#pragma once
+
+#include <expected>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Source/SourceBuffer.h"
+#include "Source/SourceLocation.h"
+
+// A location in any file of a SourceManager. Every file is given its own
+// range of offsets, so one 32-bit value tells both the file and the place in
+// it. The file, row and column are only worked out when asked for.
+//
+// Only diagnostics are kept as global locations so far. Tokens and AST nodes
+// hold a file-local SourceLocation, which SourceFile::getGlobalLocation()
+// converts.
+
+struct GlobalSourceLocation {
+    uint32_t Offset = 0;
+
+    [[nodiscard]] constexpr static auto invalid() noexcept {
+        return GlobalSourceLocation { .Offset = 0 };
+    }
+
+    [[nodiscard]] constexpr auto isValid() const noexcept {
+        return this->Offset != 0;
+    }
+};
+
+namespace ADT {
+    struct SourceLoadOptions {
+        // Read small files into one allocation shared by the whole list,
+        // instead of mapping each one. Saves a mapping (and most of a page)
+        // per file.
+        bool ReadSmallFilesIntoArena : 1 = false;
+    };
+
+    struct SourceFile {
+        std::string Path;
+        SourceBuffer *Buffer;
+
+        // Global offset of the first byte of the file. The file owns the
+        // offsets up to and including the one of its end.
+        uint32_t BaseOffset;
+
+        // Filled in the first time a location in the file is resolved.
+        mutable std::vector<uint32_t> LineStartList;
+
+        [[nodiscard]] constexpr auto
+        getGlobalLocation(const SourceLocation Loc) const noexcept {
+            if (Loc.Index == SourceLocation::invalid().Index) {
+                return GlobalSourceLocation::invalid();
+            }
+
+            return GlobalSourceLocation {
+                .Offset = this->BaseOffset + Loc.Index
+            };
+        }
+    };
+
+    struct ResolvedSourceLocation {
+        const SourceFile *File;
+        SourceLocation Loc;
+    };
+
+    // Owns every file loaded or added through it, and gives each one its
+    // range of global offsets. Files stay alive until the manager is
+    // destroyed.
+
+    struct SourceManager {
+    public:
+        // Largest file read into an arena by ReadSmallFilesIntoArena.
+        constexpr static auto SmallFileLimit = size_t(16) << 10;
+
+        using LoadResult =
+            std::expected<const SourceFile *, SourceBuffer::Error>;
+    protected:
+        // Sorted by BaseOffset, as offsets are handed out in order.
+        std::vector<std::unique_ptr<SourceFile>> FileList;
+        std::vector<std::unique_ptr<char[]>> ArenaList;
+
+        // Offset 0 is left out, so it can be the invalid location.
+        uint32_t NextOffset = 1;
+    public:
+        explicit SourceManager() noexcept = default;
+
+        SourceManager(const SourceManager &) = delete;
+        auto operator=(const SourceManager &) = delete;
+
+        ~SourceManager() noexcept;
+
+        // Opens, maps and reads every file in PathList on several threads,
+        // so that the disk has many requests to work on at once. Results are
+        // in the order of PathList.
+
+        [[nodiscard]] auto
+        loadFiles(std::span<const std::string_view> PathList,
+                  SourceLoadOptions Options = SourceLoadOptions()) noexcept
+            -> std::vector<LoadResult>;
+
+        [[nodiscard]] auto loadFile(std::string_view Path) noexcept
+            -> LoadResult;
+
+        // Takes ownership of Buffer, which wasn't loaded from disk, such as
+        // input to the repl. Fails if the manager has no offsets left.
+
+        [[nodiscard]]
+        auto addBuffer(std::string_view Path, SourceBuffer *Buffer) noexcept
+            -> LoadResult;
+
+        [[nodiscard]] auto getFile(GlobalSourceLocation Loc) const noexcept
+            -> const SourceFile *;
+
+        // Works out the file, row and column of Loc. Not safe to call from
+        // several threads at once, as the first call for a file fills in its
+        // line table.
+
+        [[nodiscard]] auto resolve(GlobalSourceLocation Loc) const noexcept
+            -> std::optional<ResolvedSourceLocation>;
+
+        [[nodiscard]] constexpr auto getFileList() const noexcept {
+            return std::span(this->FileList);
+        }
+    };
+}
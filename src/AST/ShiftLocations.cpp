@@ -0,0 +1,371 @@
+/*
+ * AST/ShiftLocations.cpp
+ * © suhas pai
+ */
+
+#include "AST/Decls/ArrayBindingVarDecl.h"
+#include "AST/Decls/ObjectBindingVarDecl.h"
+
+#include "AST/ShiftLocations.h"
+#include "AST/Visitor.h"
+
+namespace AST {
+    struct LocationShifter : public StmtVisitor<LocationShifter> {
+    protected:
+        SourceLocationShift Shift;
+
+        [[nodiscard]]
+        constexpr auto shifted(const SourceLocation Loc) const noexcept {
+            // Nodes made up by the parser, such as the return statement of an
+            // arrow function, have no location to move.
+            if (Loc.Index == SourceLocation::invalid().Index) {
+                return Loc;
+            }
+
+            return Loc.shifted(this->Shift);
+        }
+
+        void shiftQualifiers(Qualifiers &Quals) noexcept {
+            Quals.shiftLocations(this->Shift);
+        }
+
+        void shiftList(const std::span<Stmt *const> StmtList) noexcept {
+            for (const auto Stmt : StmtList) {
+                this->shift(Stmt);
+            }
+        }
+
+        void shiftArrayBindingItem(ArrayBindingItem &Item) noexcept {
+            this->shiftQualifiers(Item.getQualifiersRef());
+            if (auto Index = Item.getIndex()) {
+                this->shift(Index->IndexExpr);
+                Index->IndexLoc = this->shifted(Index->IndexLoc);
+
+                Item.setIndex(Index);
+            }
+
+            switch (Item.getKind()) {
+                case ArrayBindingItemKind::Identifier: {
+                    auto &Identifier =
+                        llvm::cast<ArrayBindingItemIdentifier>(Item);
+
+                    Identifier.setNameLoc(
+                        this->shifted(Identifier.getNameLoc()));
+                    return;
+                }
+                case ArrayBindingItemKind::Array: {
+                    auto &Array = llvm::cast<ArrayBindingItemArray>(Item);
+
+                    Array.setItemLoc(this->shifted(Array.getItemLoc()));
+                    this->shiftArrayBindingItemList(Array.getItemList());
+
+                    return;
+                }
+                case ArrayBindingItemKind::Object: {
+                    auto &Object = llvm::cast<ArrayBindingItemObject>(Item);
+
+                    Object.setItemLoc(this->shifted(Object.getItemLoc()));
+                    this->shiftObjectBindingFieldList(Object.getFieldList());
+
+                    return;
+                }
+                case ArrayBindingItemKind::Spread: {
+                    auto &Spread = llvm::cast<ArrayBindingItemSpread>(Item);
+
+                    Spread.setSpreadLoc(this->shifted(Spread.getSpreadLoc()));
+                    Spread.setNameLoc(this->shifted(Spread.getNameLoc()));
+
+                    return;
+                }
+            }
+
+            __builtin_unreachable();
+        }
+
+        void
+        shiftArrayBindingItemList(
+            const std::span<ArrayBindingItem *const> ItemList) noexcept
+        {
+            for (const auto Item : ItemList) {
+                this->shiftArrayBindingItem(*Item);
+            }
+        }
+
+        void shiftObjectBindingField(ObjectBindingField &Field) noexcept {
+            Field.setKeyLoc(this->shifted(Field.getKeyLoc()));
+            switch (Field.getKind()) {
+                case ObjectBindingFieldKind::Identifier: {
+                    auto &Identifier =
+                        llvm::cast<ObjectBindingFieldIdentifier>(Field);
+
+                    this->shiftQualifiers(Identifier.getQualifiersRef());
+                    Identifier.setNameLoc(
+                        this->shifted(Identifier.getNameLoc()));
+
+                    return;
+                }
+                case ObjectBindingFieldKind::Array: {
+                    auto &Array = llvm::cast<ObjectBindingFieldArray>(Field);
+
+                    this->shiftQualifiers(Array.getQualifiersRef());
+                    this->shiftArrayBindingItemList(Array.getItemList());
+
+                    return;
+                }
+                case ObjectBindingFieldKind::Object: {
+                    auto &Object = llvm::cast<ObjectBindingFieldObject>(Field);
+
+                    this->shiftQualifiers(Object.getQualifiersRef());
+                    this->shiftObjectBindingFieldList(Object.getFieldList());
+
+                    return;
+                }
+                case ObjectBindingFieldKind::Spread: {
+                    auto &Spread = llvm::cast<ObjectBindingFieldSpread>(Field);
+
+                    this->shiftQualifiers(Spread.getQualifiersRef());
+                    Spread.setSpreadLoc(this->shifted(Spread.getSpreadLoc()));
+
+                    return;
+                }
+            }
+
+            __builtin_unreachable();
+        }
+
+        void
+        shiftObjectBindingFieldList(
+            const std::span<ObjectBindingField *const> FieldList) noexcept
+        {
+            for (const auto Field : FieldList) {
+                this->shiftObjectBindingField(*Field);
+            }
+        }
+
+        void shiftLvalueTypedDecl(LvalueTypedDecl &Decl) noexcept {
+            this->shift(Decl.getTypeExpr());
+            this->shift(Decl.getRvalueExpr());
+        }
+    public:
+        constexpr explicit
+        LocationShifter(const SourceLocationShift Shift) noexcept
+        : Shift(Shift) {}
+
+        void shift(Stmt *const Stmt) noexcept {
+            if (Stmt == nullptr) {
+                return;
+            }
+
+            Stmt->setLoc(this->shifted(Stmt->getLoc()));
+            this->visit(*Stmt);
+        }
+
+        // Literals and DeclRefExpr only have the location stored in Stmt.
+        void visitStmt(Stmt &) noexcept {}
+
+        void visitBinaryOperation(BinaryOperation &BinOp) noexcept {
+            this->shift(&BinOp.getLhs());
+            this->shift(&BinOp.getRhs());
+        }
+
+        void visitUnaryOperation(UnaryOperation &UnaryOp) noexcept {
+            this->shift(&UnaryOp.getOperand());
+        }
+
+        void visitDotIdentifierExpr(DotIdentifierExpr &Expr) noexcept {
+            this->shiftQualifiers(Expr.getQualifiersRef());
+        }
+
+        void visitOptionalUnwrapExpr(OptionalUnwrapExpr &Expr) noexcept {
+            this->shift(Expr.getBase());
+        }
+
+        void visitParenExpr(ParenExpr &Expr) noexcept {
+            this->shift(Expr.getChildExpr());
+        }
+
+        void visitArrayDecl(ArrayDecl &Decl) noexcept {
+            this->shiftList(Decl.getElementList());
+        }
+
+        void visitClosureDecl(ClosureDecl &Decl) noexcept {
+            this->shiftList(Decl.getCaptureList());
+            this->visitFunctionDecl(Decl);
+        }
+
+        void visitEnumDecl(EnumDecl &Decl) noexcept {
+            this->shiftList(Decl.getMemberList());
+        }
+
+        void visitFunctionDecl(FunctionDecl &Decl) noexcept {
+            this->shiftQualifiers(Decl.getQualifiersRef());
+            this->shiftList(Decl.getParamList());
+            this->shift(Decl.getReturnTypeExpr());
+            this->shift(Decl.getBody());
+        }
+
+        void visitInterfaceDecl(InterfaceDecl &Decl) noexcept {
+            this->shiftList(Decl.getFieldList());
+        }
+
+        void visitStructDecl(StructDecl &Decl) noexcept {
+            this->shiftList(Decl.getFieldList());
+        }
+
+        void visitShapeDecl(ShapeDecl &Decl) noexcept {
+            this->shiftList(Decl.getFieldList());
+        }
+
+        void visitTupleDecl(TupleDecl &Decl) noexcept {
+            this->shiftList(Decl.getElementList());
+        }
+
+        void visitUnionDecl(UnionDecl &Decl) noexcept {
+            this->shiftList(Decl.getFieldList());
+        }
+
+        void visitLvalueNamedDecl(LvalueNamedDecl &Decl) noexcept {
+            this->shift(Decl.getRvalueExpr());
+        }
+
+        void visitEnumMemberDecl(EnumMemberDecl &Decl) noexcept {
+            this->shift(Decl.getRvalueExpr());
+        }
+
+        void visitFieldDecl(FieldDecl &Decl) noexcept {
+            this->shiftLvalueTypedDecl(Decl);
+        }
+
+        void visitOptionalFieldDecl(OptionalFieldDecl &Decl) noexcept {
+            this->shiftLvalueTypedDecl(Decl);
+        }
+
+        void visitVarDecl(VarDecl &Decl) noexcept {
+            this->shiftQualifiers(Decl.getQualifiersRef());
+            this->shiftLvalueTypedDecl(Decl);
+        }
+
+        void visitParamVarDecl(ParamVarDecl &Decl) noexcept {
+            this->shiftLvalueTypedDecl(Decl);
+        }
+
+        void
+        visitInlineTupleParamVarDecl(InlineTupleParamVarDecl &Decl) noexcept {
+            this->shiftLvalueTypedDecl(Decl);
+        }
+
+        void visitArrayBindingVarDecl(ArrayBindingVarDecl &Decl) noexcept {
+            this->shiftQualifiers(Decl.getQualifiersRef());
+            this->shiftArrayBindingItemList(Decl.getItemList());
+            this->shift(Decl.getInitExpr());
+        }
+
+        void
+        visitArrayBindingParamVarDecl(ArrayBindingParamVarDecl &Decl) noexcept
+        {
+            this->visitArrayBindingVarDecl(Decl);
+        }
+
+        void visitObjectBindingVarDecl(ObjectBindingVarDecl &Decl) noexcept {
+            this->shiftQualifiers(Decl.getQualifiers());
+            this->shiftObjectBindingFieldList(Decl.getFieldList());
+            this->shift(Decl.getInitExpr());
+        }
+
+        void
+        visitObjectBindingParamVarDecl(
+            ObjectBindingParamVarDecl &Decl) noexcept
+        {
+            this->visitObjectBindingVarDecl(Decl);
+        }
+
+        void visitCallExpr(CallExpr &Call) noexcept {
+            this->shiftQualifiers(Call.getQualifiersRef());
+            this->shift(Call.getCalleeExpr());
+
+            for (const auto &Arg : Call.getArgumentList()) {
+                this->shift(Arg.Expr);
+            }
+        }
+
+        void visitFieldExpr(FieldExpr &Expr) noexcept {
+            this->shift(Expr.getBase());
+        }
+
+        void visitIfExpr(IfExpr &Expr) noexcept {
+            this->shift(Expr.getCond());
+            this->shift(Expr.getThen());
+            this->shift(Expr.getElse());
+        }
+
+        void visitArraySubscriptExpr(ArraySubscriptExpr &Expr) noexcept {
+            this->shift(Expr.getBase());
+            this->shiftList(Expr.getDetailList());
+        }
+
+        void visitCastExpr(CastExpr &Expr) noexcept {
+            this->shift(Expr.getOperand());
+            this->shift(Expr.getTypeExpr());
+        }
+
+        void visitDerefExpr(DerefExpr &Expr) noexcept {
+            this->shift(Expr.getOperand());
+        }
+
+        void visitCaptureAllByRefExpr(CaptureAllByRefExpr &Expr) noexcept {
+            this->shiftQualifiers(Expr.getQualifiersRef());
+        }
+
+        void visitCaptureAllByValueExpr(CaptureAllByValueExpr &Expr) noexcept {
+            this->shiftQualifiers(Expr.getQualifiersRef());
+        }
+
+        void visitArrayTypeExpr(ArrayTypeExpr &Expr) noexcept {
+            this->shiftQualifiers(Expr.getQualifiersRef());
+            this->shift(Expr.getSizeExpr());
+            this->shift(Expr.getConstraintExpr());
+            this->shift(Expr.getBase());
+        }
+
+        void visitFunctionTypeExpr(FunctionTypeExpr &Expr) noexcept {
+            this->shiftList(Expr.getParamList());
+            this->shift(Expr.getReturnType());
+        }
+
+        void visitOptionalTypeExpr(OptionalTypeExpr &Expr) noexcept {
+            this->shift(Expr.getOperand());
+        }
+
+        void visitPointerTypeExpr(PointerTypeExpr &Expr) noexcept {
+            this->shift(Expr.getOperand());
+        }
+
+        void visitArrayPointerTypeExpr(ArrayPointerTypeExpr &Expr) noexcept {
+            this->shiftQualifiers(Expr.getQualifiersRef());
+            this->shift(Expr.getBase());
+        }
+
+        void visitCompoundStmt(CompoundStmt &Stmt) noexcept {
+            this->shiftList(Stmt.getStmtList());
+        }
+
+        void visitForStmt(ForStmt &Stmt) noexcept {
+            this->shift(Stmt.getInit());
+            this->shift(Stmt.getCond());
+            this->shift(Stmt.getStep());
+            this->shift(Stmt.getBody());
+        }
+
+        void visitCommaSepStmtList(CommaSepStmtList &List) noexcept {
+            this->shiftList(List.getStmtList());
+        }
+
+        void visitReturnStmt(ReturnStmt &Stmt) noexcept {
+            this->shift(Stmt.getValue());
+        }
+    };
+
+    void ShiftLocations(Stmt &Stmt, const SourceLocationShift Shift) noexcept {
+        LocationShifter(Shift).shift(&Stmt);
+    }
+}
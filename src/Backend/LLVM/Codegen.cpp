@@ -2,10 +2,370 @@
  * Backend/LLVM/Codegen.cpp
  */
 
+#include <cassert>
+
+#include "AST/Types/ArrayType.h"
+#include "AST/Types/OptionalType.h"
+#include "AST/Types/PointerType.h"
+
 #include "Backend/LLVM/Codegen.h"
+#include "Sema/Comptime/TypeRules.h"
 #include "llvm/IR/Verifier.h"
 
 namespace Backend::LLVM {
+    auto
+    GetLLVMType(const Sema::BuiltinType &Type,
+                llvm::LLVMContext &Context) noexcept -> llvm::Type *
+    {
+        switch (Type.getCategory()) {
+            case Sema::BuiltinType::Category::Void:
+                return llvm::Type::getVoidTy(Context);
+            case Sema::BuiltinType::Category::UnsignedInteger:
+            case Sema::BuiltinType::Category::SignedInteger:
+            case Sema::BuiltinType::Category::Bool:
+                return llvm::Type::getIntNTy(Context, Type.getBitWidth());
+            case Sema::BuiltinType::Category::FloatingPoint:
+                switch (Type.getBitWidth()) {
+                    case 16:
+                        return llvm::Type::getHalfTy(Context);
+                    case 32:
+                        return llvm::Type::getFloatTy(Context);
+                    case 64:
+                        return llvm::Type::getDoubleTy(Context);
+                }
+
+                // LLVM has no 8-bit floating-point type.
+                return nullptr;
+        }
+
+        __builtin_unreachable();
+    }
+
+    static auto
+    GetLLVMTypeOrDiag(const Sema::BuiltinType &Type,
+                      Handler &Handler,
+                      const SourceLocation Loc) noexcept -> llvm::Type *
+    {
+        const auto Result = GetLLVMType(Type, Handler.getContext());
+        if (Result == nullptr) {
+            Handler.getDiag().consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Loc,
+                .Message =
+                    std::format("Type \"{}\" is not yet supported",
+                                Type.getName())
+            });
+        }
+
+        return Result;
+    }
+
+    // Maps a type expression to its type in Handler's TypeContext, or returns
+    // null if the expression isn't a type that's understood yet.
+
+    static auto
+    ResolveType(const AST::Expr &TypeExpr, Sema::TypeContext &Context) noexcept
+        -> Sema::Type *
+    {
+        if (const auto DeclRef = llvm::dyn_cast<AST::DeclRefExpr>(&TypeExpr)) {
+            return Sema::TypeContext::getBuiltinType(DeclRef->getName());
+        }
+
+        if (const auto PtrExpr =
+                llvm::dyn_cast<AST::PointerTypeExpr>(&TypeExpr))
+        {
+            if (PtrExpr->getOperand() == nullptr) {
+                return nullptr;
+            }
+
+            const auto Pointee = ResolveType(*PtrExpr->getOperand(), Context);
+            if (Pointee == nullptr) {
+                return nullptr;
+            }
+
+            return &Context.getPointerType(*Pointee,
+                                           Sema::PointerBaseTypeQualifiers());
+        }
+
+        if (const auto OptExpr =
+                llvm::dyn_cast<AST::OptionalTypeExpr>(&TypeExpr))
+        {
+            if (OptExpr->getOperand() == nullptr) {
+                return nullptr;
+            }
+
+            const auto Base = ResolveType(*OptExpr->getOperand(), Context);
+            if (Base == nullptr) {
+                return nullptr;
+            }
+
+            return &Context.getOptionalType(*Base);
+        }
+
+        if (const auto ArrayExpr =
+                llvm::dyn_cast<AST::ArrayTypeExpr>(&TypeExpr))
+        {
+            if (ArrayExpr->getBase() == nullptr) {
+                return nullptr;
+            }
+
+            const auto Element = ResolveType(*ArrayExpr->getBase(), Context);
+            if (Element == nullptr) {
+                return nullptr;
+            }
+
+            // Only a literal length can be known before Sema evaluates
+            // constants.
+
+            auto Length = std::optional<uint64_t>();
+            if (const auto SizeExpr = ArrayExpr->getSizeExpr()) {
+                const auto NumLit =
+                    llvm::dyn_cast<AST::NumberLiteral>(SizeExpr);
+
+                if (NumLit == nullptr) {
+                    return nullptr;
+                }
+
+                const auto &Number = NumLit->getNumber().Success;
+                if (Number.Kind != Lex::NumberKind::UnsignedInteger) {
+                    return nullptr;
+                }
+
+                Length = Number.UInt;
+            }
+
+            return &Context.getArrayType(*Element, Length);
+        }
+
+        return nullptr;
+    }
+
+    // Codegen only handles builtin types so far. Without a type expression, a
+    // value is an f64.
+
+    static auto
+    ResolveTypeExpr(const AST::Expr *const TypeExpr, Handler &Handler) noexcept
+        -> const Sema::BuiltinType *
+    {
+        if (TypeExpr == nullptr) {
+            return &Sema::BuiltinType::f64();
+        }
+
+        const auto Type = ResolveType(*TypeExpr, Handler.getTypeContext());
+        if (Type == nullptr) {
+            Handler.getDiag().consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = TypeExpr->getLoc(),
+                .Message = "Unknown type"
+            });
+
+            return nullptr;
+        }
+
+        if (const auto Builtin = llvm::dyn_cast<Sema::BuiltinType>(Type)) {
+            return Builtin;
+        }
+
+        Handler.getDiag().consume({
+            .Level = DiagnosticLevel::Error,
+            .Location = TypeExpr->getLoc(),
+            .Message =
+                std::format("Type \"{}\" is not yet supported in codegen",
+                            Type->getName())
+        });
+
+        return nullptr;
+    }
+
+    static auto IsBoolResultOperator(const Parse::BinaryOperator Oper) noexcept
+    {
+        switch (Oper) {
+            case Parse::BinaryOperator::LogicalAnd:
+            case Parse::BinaryOperator::LogicalOr:
+            case Parse::BinaryOperator::LessThan:
+            case Parse::BinaryOperator::GreaterThan:
+            case Parse::BinaryOperator::LessThanOrEqual:
+            case Parse::BinaryOperator::GreaterThanOrEqual:
+            case Parse::BinaryOperator::Equality:
+            case Parse::BinaryOperator::Inequality:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static auto
+    ComputeExprType(const AST::Expr &Expr, ValueMap &ValueMap) noexcept
+        -> const Sema::BuiltinType &
+    {
+        if (const auto ParenExpr = llvm::dyn_cast<AST::ParenExpr>(&Expr)) {
+            return GetExprType(*ParenExpr->getChildExpr(), ValueMap);
+        }
+
+        if (const auto UnaryOp = llvm::dyn_cast<AST::UnaryOperation>(&Expr)) {
+            if (UnaryOp->getOperator() == Parse::UnaryOperator::LogicalNot) {
+                return Sema::BuiltinType::boolType();
+            }
+
+            return GetExprType(UnaryOp->getOperand(), ValueMap);
+        }
+
+        const auto &BinOp = llvm::cast<AST::BinaryOperation>(Expr);
+        if (IsBoolResultOperator(BinOp.getOperator())) {
+            return Sema::BuiltinType::boolType();
+        }
+
+        // The rules are shared with the constant folder, so folding doesn't
+        // change what the code computes.
+
+        return Sema::Comptime::GetOperandType(
+            BinOp,
+            GetExprType(BinOp.getLhs(), ValueMap),
+            GetExprType(BinOp.getRhs(), ValueMap));
+    }
+
+    auto GetExprType(const AST::Expr &Expr, ValueMap &ValueMap) noexcept
+        -> const Sema::BuiltinType &
+    {
+        if (const auto NumLit = llvm::dyn_cast<AST::NumberLiteral>(&Expr)) {
+            const auto &Number = NumLit->getNumber().Success;
+            if (const auto Type = Sema::BuiltinType::forName(Number.Suffix)) {
+                return *Type;
+            }
+
+            switch (Number.Kind) {
+                case Lex::NumberKind::UnsignedInteger:
+                    // Only literals too large for an s64 are unsigned.
+                    if (Number.UInt > INT64_MAX) {
+                        return Sema::BuiltinType::u64();
+                    }
+
+                    return Sema::BuiltinType::s64();
+                case Lex::NumberKind::SignedInteger:
+                    return Sema::BuiltinType::s64();
+                case Lex::NumberKind::FloatingPoint:
+                    return Sema::BuiltinType::f64();
+            }
+
+            __builtin_unreachable();
+        }
+
+        if (llvm::isa<AST::CharLiteral>(Expr)) {
+            return Sema::BuiltinType::u8();
+        }
+
+        if (const auto DeclRef = llvm::dyn_cast<AST::DeclRefExpr>(&Expr)) {
+            if (const auto Type = ValueMap.getType(*DeclRef)) {
+                return *Type;
+            }
+
+            return Sema::BuiltinType::f64();
+        }
+
+        if (!llvm::isa<AST::ParenExpr,
+                       AST::UnaryOperation,
+                       AST::BinaryOperation>(Expr))
+        {
+            return Sema::BuiltinType::f64();
+        }
+
+        // Every operation is typed again by the one it's an operand of, so
+        // keep the type instead of walking the whole chain below it again.
+
+        if (const auto Type = ValueMap.getExprType(Expr)) {
+            return *Type;
+        }
+
+        const auto &Type = ComputeExprType(Expr, ValueMap);
+        ValueMap.setExprType(Expr, Type);
+
+        return Type;
+    }
+
+    // Converts Value from type From to type To. Any non-zero value converts
+    // to true.
+
+    static auto
+    ConvertValue(llvm::IRBuilder<> &Builder,
+                 llvm::Value *const Value,
+                 const Sema::BuiltinType &From,
+                 const Sema::BuiltinType &To) noexcept -> llvm::Value *
+    {
+        const auto ToType = GetLLVMType(To, Builder.getContext());
+        assert(ToType != nullptr && "Converting to an unsupported type");
+
+        if (&From == &To || Value->getType() == ToType) {
+            return Value;
+        }
+
+        if (From.isFloatingPoint()) {
+            if (To.isFloatingPoint()) {
+                return Builder.CreateFPCast(Value, ToType);
+            }
+
+            if (To.isBool()) {
+                const auto Zero =
+                    llvm::Constant::getNullValue(Value->getType());
+
+                return Builder.CreateFCmpUNE(Value, Zero);
+            }
+
+            return To.isSignedInteger() ?
+                Builder.CreateFPToSI(Value, ToType) :
+                Builder.CreateFPToUI(Value, ToType);
+        }
+
+        if (To.isFloatingPoint()) {
+            return From.isSignedInteger() ?
+                Builder.CreateSIToFP(Value, ToType) :
+                Builder.CreateUIToFP(Value, ToType);
+        }
+
+        if (To.isBool()) {
+            return Builder.CreateIsNotNull(Value);
+        }
+
+        return Builder.CreateIntCast(Value, ToType, From.isSignedInteger());
+    }
+
+    // Converts Value, generated from Expr, to type To, when the conversion
+    // isn't written out. A number literal without a suffix that doesn't fit
+    // in To is an error, rather than being truncated.
+
+    static auto
+    ConvertImplicitly(Handler &Handler,
+                      llvm::IRBuilder<> &Builder,
+                      llvm::Value *const Value,
+                      const AST::Expr &Expr,
+                      const Sema::BuiltinType &From,
+                      const Sema::BuiltinType &To) noexcept
+        -> std::optional<llvm::Value *>
+    {
+        const auto Result = ConvertValue(Builder, Value, From, To);
+
+        // Constants are uniqued, so converting a literal back gives the same
+        // constant only if nothing was lost.
+
+        if (Sema::Comptime::IsUntypedLiteral(Expr) &&
+            To.isInteger() &&
+            !From.isFloatingPoint() &&
+            llvm::isa<llvm::ConstantInt>(Value) &&
+            ConvertValue(Builder, Result, To, From) != Value)
+        {
+            Handler.getDiag().consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Expr.getLoc(),
+                .Message =
+                    std::format("Number literal doesn't fit in type \"{}\"",
+                                To.getName())
+            });
+
+            return std::nullopt;
+        }
+
+        return Result;
+    }
+
     auto
     BinaryOperationCodegen(AST::BinaryOperation &BinOp,
                            Handler &Handler,
@@ -25,61 +385,196 @@ namespace Backend::LLVM {
             return std::nullopt;
         }
 
-        auto &Context = Handler.getContext();
+        const auto &LhsType = GetExprType(BinOp.getLhs(), ValueMap);
+        const auto &RhsType = GetExprType(BinOp.getRhs(), ValueMap);
+        const auto &Type =
+            Sema::Comptime::GetOperandType(BinOp, LhsType, RhsType);
+        const auto &BoolType = Sema::BuiltinType::boolType();
+
+        const auto LeftConvOpt =
+            ConvertImplicitly(Handler, Builder,
+                              LeftOpt.value(),
+                              BinOp.getLhs(),
+                              LhsType,
+                              Type);
+        const auto RightConvOpt =
+            ConvertImplicitly(Handler, Builder,
+                              RightOpt.value(),
+                              BinOp.getRhs(),
+                              RhsType,
+                              Type);
+
+        if (!LeftConvOpt.has_value() || !RightConvOpt.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto Left = LeftConvOpt.value();
+        const auto Right = RightConvOpt.value();
 
-        const auto Left = LeftOpt.value();
-        const auto Right = RightOpt.value();
+        const auto IsFloat = Type.isFloatingPoint();
+        const auto IsSigned = Type.isSignedInteger();
+
+        const auto NeedIntegerOperands = [&]() noexcept {
+            Handler.getDiag().consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = BinOp.getLoc(),
+                .Message =
+                    std::format("Bitwise operator needs integer operands, not "
+                                "\"{}\"",
+                                Type.getName())
+            });
+
+            return std::nullopt;
+        };
 
         switch (BinOp.getOperator()) {
             case Parse::BinaryOperator::Assignment:
                 __builtin_unreachable();
             case Parse::BinaryOperator::Add:
-                return Builder.CreateFAdd(Left, Right, /*Name=*/"addtmp");
+                if (IsFloat) {
+                    return Builder.CreateFAdd(Left, Right, /*Name=*/"addtmp");
+                }
+
+                return Builder.CreateAdd(Left, Right, /*Name=*/"addtmp");
             case Parse::BinaryOperator::Subtract:
-                return Builder.CreateFSub(Left, Right, /*Name=*/"subtmp");
+                if (IsFloat) {
+                    return Builder.CreateFSub(Left, Right, /*Name=*/"subtmp");
+                }
+
+                return Builder.CreateSub(Left, Right, /*Name=*/"subtmp");
             case Parse::BinaryOperator::Multiply:
-                return Builder.CreateFMul(Left, Right, /*Name=*/"multmp");
+                if (IsFloat) {
+                    return Builder.CreateFMul(Left, Right, /*Name=*/"multmp");
+                }
+
+                return Builder.CreateMul(Left, Right, /*Name=*/"multmp");
             case Parse::BinaryOperator::Modulo:
-                return Builder.CreateFRem(Left, Right, /*Name=*/"modtmp");
+                if (IsFloat) {
+                    return Builder.CreateFRem(Left, Right, /*Name=*/"modtmp");
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateSRem(Left, Right, /*Name=*/"modtmp");
+                }
+
+                return Builder.CreateURem(Left, Right, /*Name=*/"modtmp");
             case Parse::BinaryOperator::Divide:
-                return Builder.CreateFDiv(Left, Right, /*Name=*/"divtmp");
+                if (IsFloat) {
+                    return Builder.CreateFDiv(Left, Right, /*Name=*/"divtmp");
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateSDiv(Left, Right, /*Name=*/"divtmp");
+                }
+
+                return Builder.CreateUDiv(Left, Right, /*Name=*/"divtmp");
             case Parse::BinaryOperator::LogicalAnd:
-                return Builder.CreateAnd(Left, Right, /*Name=*/"andtmp");
+                return Builder.CreateAnd(
+                    ConvertValue(Builder, Left, Type, BoolType),
+                    ConvertValue(Builder, Right, Type, BoolType),
+                    /*Name=*/"andtmp");
             case Parse::BinaryOperator::LogicalOr:
-                return Builder.CreateOr(Left, Right, /*Name=*/"ortmp");
+                return Builder.CreateOr(
+                    ConvertValue(Builder, Left, Type, BoolType),
+                    ConvertValue(Builder, Right, Type, BoolType),
+                    /*Name=*/"ortmp");
             case Parse::BinaryOperator::BitwiseAnd:
+                if (IsFloat) {
+                    return NeedIntegerOperands();
+                }
+
                 return Builder.CreateAnd(Left, Right, /*Name=*/"andtmp");
             case Parse::BinaryOperator::BitwiseOr:
+                if (IsFloat) {
+                    return NeedIntegerOperands();
+                }
+
                 return Builder.CreateOr(Left, Right, /*Name=*/"ortmp");
             case Parse::BinaryOperator::BitwiseXor:
+                if (IsFloat) {
+                    return NeedIntegerOperands();
+                }
+
                 return Builder.CreateXor(Left, Right, /*Name=*/"xortmp");
             case Parse::BinaryOperator::LeftShift:
+                if (IsFloat) {
+                    return NeedIntegerOperands();
+                }
+
                 return Builder.CreateShl(Left, Right, /*Name=*/"lshifttmp");
             case Parse::BinaryOperator::RightShift:
-                return Builder.CreateAShr(Left, Right, /*Name=*/"rshifttmp");
+                if (IsFloat) {
+                    return NeedIntegerOperands();
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateAShr(Left, Right,
+                                              /*Name=*/"rshifttmp");
+                }
+
+                return Builder.CreateLShr(Left, Right,
+                                          /*Name=*/"rshifttmp");
             case Parse::BinaryOperator::LessThan:
-                return Builder.CreateFCmpOLT(Left, Right, /*Name=*/"lttmp");
+                if (IsFloat) {
+                    return Builder.CreateFCmpOLT(Left, Right, /*Name=*/"lttmp");
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateICmpSLT(Left, Right, /*Name=*/"lttmp");
+                }
+
+                return Builder.CreateICmpULT(Left, Right, /*Name=*/"lttmp");
             case Parse::BinaryOperator::GreaterThan:
-                return Builder.CreateFCmpOGT(Left, Right, /*Name=*/"gttmp");
+                if (IsFloat) {
+                    return Builder.CreateFCmpOGT(Left, Right, /*Name=*/"gttmp");
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateICmpSGT(Left, Right, /*Name=*/"gttmp");
+                }
+
+                return Builder.CreateICmpUGT(Left, Right, /*Name=*/"gttmp");
             case Parse::BinaryOperator::LessThanOrEqual:
-                return Builder.CreateFCmpOLE(Left, Right, /*Name=*/"letmp");
+                if (IsFloat) {
+                    return Builder.CreateFCmpOLE(Left, Right, /*Name=*/"letmp");
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateICmpSLE(Left, Right, /*Name=*/"letmp");
+                }
+
+                return Builder.CreateICmpULE(Left, Right, /*Name=*/"letmp");
             case Parse::BinaryOperator::GreaterThanOrEqual:
-                return Builder.CreateFCmpOGE(Left, Right, /*Name=*/"getmp");
+                if (IsFloat) {
+                    return Builder.CreateFCmpOGE(Left, Right, /*Name=*/"getmp");
+                }
+
+                if (IsSigned) {
+                    return Builder.CreateICmpSGE(Left, Right, /*Name=*/"getmp");
+                }
+
+                return Builder.CreateICmpUGE(Left, Right, /*Name=*/"getmp");
             case Parse::BinaryOperator::Equality:
-                return Builder.CreateFCmpOEQ(Left, Right, /*Name=*/"eqtmp");
+                if (IsFloat) {
+                    return Builder.CreateFCmpOEQ(Left, Right, /*Name=*/"eqtmp");
+                }
+
+                return Builder.CreateICmpEQ(Left, Right, /*Name=*/"eqtmp");
             case Parse::BinaryOperator::Inequality:
-                return Builder.CreateFCmpONE(Left, Right, /*Name=*/"nqtmp");
+                if (IsFloat) {
+                    return Builder.CreateFCmpUNE(Left, Right, /*Name=*/"nqtmp");
+                }
+
+                return Builder.CreateICmpNE(Left, Right, /*Name=*/"nqtmp");
             case Parse::BinaryOperator::Power: {
+                auto &DoubleType = Sema::BuiltinType::f64();
+
                 const auto LeftDouble =
-                    Builder.CreateUIToFP(Left,
-                                         llvm::Type::getDoubleTy(Context));
+                    ConvertValue(Builder, Left, Type, DoubleType);
                 const auto RightDouble =
-                    Builder.CreateUIToFP(Right,
-                                         llvm::Type::getDoubleTy(Context));
+                    ConvertValue(Builder, Right, Type, DoubleType);
 
-                const auto PowFunc =
-                    llvm::dyn_cast_if_present<llvm::Function>(
-                        ValueMap.getValue("pow"));
+                const auto PowFunc = Handler.getModule().getFunction("pow");
 
                 if (PowFunc == nullptr) {
                     Handler.getDiag().consume({
@@ -91,8 +586,11 @@ namespace Backend::LLVM {
                     return std::nullopt;
                 }
 
-                return Builder.CreateCall(PowFunc, {LeftDouble, RightDouble},
-                                          "powtmp");
+                const auto Result =
+                    Builder.CreateCall(PowFunc, {LeftDouble, RightDouble},
+                                       "powtmp");
+
+                return ConvertValue(Builder, Result, DoubleType, Type);
             }
             case Parse::BinaryOperator::AddAssign:
             case Parse::BinaryOperator::SubtractAssign:
@@ -134,30 +632,18 @@ namespace Backend::LLVM {
         // Create blocks for the then and else cases. Insert the 'then' block at
         // the end of the function.
 
-        auto AddedDecls = std::vector<std::string_view>();
-        for (const auto &Stmt : CompoundStmt.getStmtList()) {
-            if (const auto ResultOpt =
-                    Handler.codegen(*Stmt, Builder, ValueMap))
-            {
-                if (const auto Decl =
-                        llvm::dyn_cast<AST::LvalueNamedDecl>(Stmt))
-                {
-                    ValueMap.add(Decl->getName(), ResultOpt.value());
-                    AddedDecls.push_back(Decl->getName());
-                }
+        // Every local has its own slot, so nothing has to be removed when the
+        // block ends.
 
-                continue;
+        for (const auto &Stmt : CompoundStmt.getStmtList()) {
+            const auto ResultOpt = Handler.codegen(*Stmt, Builder, ValueMap);
+            if (!ResultOpt.has_value()) {
+                return std::nullopt;
             }
 
-            for (const auto Name : AddedDecls) {
-                ValueMap.removeValue(Name);
+            if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(Stmt)) {
+                ValueMap.setValue(*Decl, ResultOpt.value());
             }
-
-            return std::nullopt;
-        }
-
-        for (const auto Name : AddedDecls) {
-            ValueMap.removeValue(Name);
         }
 
         return nullptr;
@@ -229,52 +715,140 @@ namespace Backend::LLVM {
         return std::nullopt;
     }
 
-    auto
-    FunctionDeclCodegen(AST::FunctionDecl &FuncDecl,
-                        Handler &Handler,
-                        llvm::IRBuilder<> &Builder,
-                        ValueMap &ValueMap) noexcept
+    // Native callers, such as the JIT calling a function that returns a
+    // bool, read a whole register. Values narrower than one have to be
+    // extended for the upper bits to be defined.
+
+    static auto GetExtensionAttr(const Sema::BuiltinType &Type) noexcept
+        -> std::optional<llvm::Attribute::AttrKind>
+    {
+        if ((!Type.isInteger() && !Type.isBool()) || Type.getBitWidth() >= 32) {
+            return std::nullopt;
+        }
+
+        return Type.isSignedInteger() ?
+            llvm::Attribute::SExt : llvm::Attribute::ZExt;
+    }
+
+    // Generates FuncDecl once its slots are in ValueMap, so the types of its
+    // parameters can be kept in their slots before the function is created.
+
+    static auto
+    GenerateFunction(AST::FunctionDecl &FuncDecl,
+                     Handler &Handler,
+                     ValueMap &ValueMap) noexcept
         -> std::optional<llvm::Value *>
     {
-        auto &Context = Handler.getContext();
         auto &Module = Handler.getModule();
 
-        const auto DoubleTy = llvm::Type::getDoubleTy(Context);
-        const auto ParamList =
-            std::vector(FuncDecl.getParamList().size(), DoubleTy);
+        auto ParamTypeList = std::vector<const Sema::BuiltinType *>();
+        auto ParamList = std::vector<llvm::Type *>();
+
+        for (const auto Param : FuncDecl.getParamList()) {
+            const auto TypedDecl = llvm::dyn_cast<AST::LvalueTypedDecl>(Param);
+            const auto Type =
+                ResolveTypeExpr(
+                    TypedDecl != nullptr ? TypedDecl->getTypeExpr() : nullptr,
+                    Handler);
+
+            if (Type == nullptr) {
+                return std::nullopt;
+            }
+
+            const auto LLVMType =
+                GetLLVMTypeOrDiag(*Type, Handler, FuncDecl.getLoc());
+
+            if (LLVMType == nullptr) {
+                return std::nullopt;
+            }
+
+            // The return type may be inferred from the parameters.
+            if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(Param))
+            {
+                ValueMap.setType(*Decl, *Type);
+            }
+
+            ParamTypeList.push_back(Type);
+            ParamList.push_back(LLVMType);
+        }
+
+        // A function without a return type that just returns an expression
+        // returns the expression's type.
+
+        const auto Body = FuncDecl.getBody();
+        auto ReturnType = static_cast<const Sema::BuiltinType *>(nullptr);
+
+        if (const auto RetStmt =
+                llvm::dyn_cast_if_present<AST::ReturnStmt>(Body);
+            RetStmt != nullptr &&
+            RetStmt->getValue() != nullptr &&
+            FuncDecl.getReturnTypeExpr() == nullptr)
+        {
+            ReturnType = &GetExprType(*RetStmt->getValue(), ValueMap);
+        } else {
+            ReturnType = ResolveTypeExpr(FuncDecl.getReturnTypeExpr(), Handler);
+            if (ReturnType == nullptr) {
+                return std::nullopt;
+            }
+        }
+
+        const auto ReturnLLVMType =
+            GetLLVMTypeOrDiag(*ReturnType, Handler, FuncDecl.getLoc());
+
+        if (ReturnLLVMType == nullptr) {
+            return std::nullopt;
+        }
+
         const auto FT =
-            llvm::FunctionType::get(DoubleTy, ParamList,/*isVarArg=*/false);
-        const auto FuncDeclCodegen =
+            llvm::FunctionType::get(ReturnLLVMType,
+                                    ParamList,
+                                    /*isVarArg=*/false);
+        const auto Function =
             llvm::Function::Create(FT,
                                    llvm::Function::ExternalLinkage,
                                    "FIXME_Name",
                                    Module);
 
+        // Return statements convert their value to the function's return
+        // type.
+        ValueMap.setReturnType(*Function, *ReturnType);
+        if (const auto Attr = GetExtensionAttr(*ReturnType)) {
+            Function->addRetAttr(Attr.value());
+        }
+
         // Set names for all arguments.
-        #if 0
-        auto Idx = unsigned();
-        for (auto &Arg : FuncDeclCodegen->args()) {
-            // Arg.setName(FuncDecl.getParamList()[Idx++]->getName());
+        for (auto &Arg : Function->args()) {
+            const auto Param = FuncDecl.getParamList()[Arg.getArgNo()];
+            if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(Param))
+            {
+                Arg.setName(Decl->getName());
+            }
+
+            auto &ParamType = *ParamTypeList[Arg.getArgNo()];
+            if (const auto Attr = GetExtensionAttr(ParamType)) {
+                Arg.addAttr(Attr.value());
+            }
         }
-        #endif
 
         // Avoid adding the function to the symbol table if it is external.
-        const auto Body = FuncDecl.getBody();
         if (Body == nullptr) {
-            return FuncDeclCodegen;
+            return Function;
         }
 
         // FIXME:
         // ValueMap.addValue(FuncDecl.getName(), FuncDeclCodegen);
 
-        const auto Function = llvm::cast<llvm::Function>(FuncDeclCodegen);
         const auto BB =
             llvm::BasicBlock::Create(Handler.getContext(),
                                      "entry",
                                      Function);
 
         for (auto &Arg : Function->args()) {
-            ValueMap.add(Arg.getName(), &Arg);
+            const auto Param = FuncDecl.getParamList()[Arg.getArgNo()];
+            if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(Param))
+            {
+                ValueMap.setValue(*Decl, &Arg);
+            }
         }
 
         auto BodyIRBuilder = llvm::IRBuilder(BB);
@@ -285,10 +859,6 @@ namespace Backend::LLVM {
             return std::nullopt;
         }
 
-        for (auto &Arg : Function->args()) {
-            ValueMap.removeValue(Arg.getName());
-        }
-
         // Finish off the function.
         // Validate the generated code, checking for consistency.
         llvm::verifyFunction(*Function);
@@ -298,6 +868,20 @@ namespace Backend::LLVM {
         return Function;
     }
 
+    auto
+    FunctionDeclCodegen(AST::FunctionDecl &FuncDecl,
+                        Handler &Handler,
+                        llvm::IRBuilder<> &Builder,
+                        ValueMap &ValueMap) noexcept
+        -> std::optional<llvm::Value *>
+    {
+        ValueMap.beginFunction(FuncDecl);
+        const auto Result = GenerateFunction(FuncDecl, Handler, ValueMap);
+
+        ValueMap.endFunction();
+        return Result;
+    }
+
     auto
     IfStmtCodegen(AST::IfExpr &IfStmt,
                   Handler &Handler,
@@ -312,22 +896,14 @@ namespace Backend::LLVM {
             return std::nullopt;
         }
 
-        auto CondValue = CondValueOpt.value();
         auto &Context = Handler.getContext();
 
-        if (!llvm::isa<llvm::ConstantInt>(CondValue)) {
-            // Convert condition to a bool by comparing non-equal to 0.0.
-            const auto ZeroFP =
-                llvm::ConstantFP::get(Context, llvm::APFloat(0.0));
-
-            CondValue = Builder.CreateICmpNE(CondValue, ZeroFP, "ifcond");
-        } else {
-            // Convert condition to a bool by comparing non-equal to 0.0.
-            const auto ZeroFP =
-                llvm::ConstantInt::get(llvm::Type::getInt32Ty(Context), 0);
-
-            CondValue = Builder.CreateICmpNE(CondValue, ZeroFP, "ifcond");
-        }
+        // Convert condition to a bool by comparing non-equal to zero.
+        const auto CondValue =
+            ConvertValue(Builder,
+                         CondValueOpt.value(),
+                         GetExprType(*IfStmt.getCond(), ValueMap),
+                         Sema::BuiltinType::boolType());
 
         const auto TheFunction = Builder.GetInsertBlock()->getParent();
 
@@ -351,8 +927,6 @@ namespace Backend::LLVM {
             ElseBB->eraseFromParent();
 
             CondBrValue->eraseFromParent();
-            CondValue->deleteValue();
-
             return std::nullopt;
         }
 
@@ -368,8 +942,6 @@ namespace Backend::LLVM {
                 ElseBB->eraseFromParent();
 
                 CondBrValue->eraseFromParent();
-                CondValue->deleteValue();
-
                 return std::nullopt;
             }
         }
@@ -384,15 +956,71 @@ namespace Backend::LLVM {
                          ValueMap &ValueMap) noexcept
         -> std::optional<llvm::Value *>
     {
-        auto &Context = Handler.getContext();
-        #if 0
-        return llvm::ConstantInt::get(llvm::Type::getInt64Ty(Context),
-                                      Number.UInt,
-                                      /*IsSigned=*/true);
-        #endif
+        const auto &Type = GetExprType(NumLit, ValueMap);
+        const auto LLVMType = GetLLVMTypeOrDiag(Type, Handler, NumLit.getLoc());
+
+        if (LLVMType == nullptr) {
+            return std::nullopt;
+        }
+
+        const auto &Number = NumLit.getNumber().Success;
+        if (Type.isFloatingPoint()) {
+            switch (Number.Kind) {
+                case Lex::NumberKind::UnsignedInteger:
+                    return llvm::ConstantFP::get(
+                        LLVMType, static_cast<double>(Number.UInt));
+                case Lex::NumberKind::SignedInteger:
+                    return llvm::ConstantFP::get(
+                        LLVMType, static_cast<double>(Number.SInt));
+                case Lex::NumberKind::FloatingPoint:
+                    return llvm::ConstantFP::get(LLVMType, Number.Float64);
+            }
+
+            __builtin_unreachable();
+        }
+
+        const auto BitWidth = Type.getBitWidth();
+        const auto IsSigned = Number.Kind == Lex::NumberKind::SignedInteger;
+
+        auto Fits = false;
+        switch (Number.Kind) {
+            case Lex::NumberKind::UnsignedInteger:
+                if (Type.isSignedInteger()) {
+                    Fits = Number.UInt < (uint64_t(1) << (BitWidth - 1));
+                } else {
+                    Fits = BitWidth == 64 || (Number.UInt >> BitWidth) == 0;
+                }
+
+                break;
+            case Lex::NumberKind::SignedInteger:
+                if (Type.isSignedInteger()) {
+                    Fits =
+                        BitWidth == 64 ||
+                        (Number.SInt >= -(int64_t(1) << (BitWidth - 1)) &&
+                         Number.SInt < (int64_t(1) << (BitWidth - 1)));
+                } else {
+                    Fits = Number.SInt >= 0 &&
+                           (BitWidth == 64 || (Number.UInt >> BitWidth) == 0);
+                }
+
+                break;
+            case Lex::NumberKind::FloatingPoint:
+                break;
+        }
+
+        if (!Fits) {
+            Handler.getDiag().consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = NumLit.getLoc(),
+                .Message =
+                    std::format("Number literal doesn't fit in type \"{}\"",
+                                Type.getName())
+            });
 
-        const auto FloatVal = (double)NumLit.getNumber().Success.UInt;
-        return llvm::ConstantFP::get(Context, llvm::APFloat(FloatVal));
+            return std::nullopt;
+        }
+
+        return llvm::ConstantInt::get(LLVMType, Number.UInt, IsSigned);
     }
 
     auto
@@ -416,13 +1044,32 @@ namespace Backend::LLVM {
             return Builder.CreateRetVoid();
         }
 
-        if (const auto ResultOpt =
-                Handler.codegen(*RetStmt.getValue(), Builder, ValueMap))
-        {
-            return Builder.CreateRet(ResultOpt.value());
+        const auto ResultOpt =
+            Handler.codegen(*RetStmt.getValue(), Builder, ValueMap);
+
+        if (!ResultOpt.has_value()) {
+            return std::nullopt;
         }
 
-        return std::nullopt;
+        auto Result = ResultOpt.value();
+
+        const auto Function = Builder.GetInsertBlock()->getParent();
+        if (const auto ReturnType = ValueMap.getReturnType(*Function)) {
+            const auto ConvOpt =
+                ConvertImplicitly(Handler, Builder,
+                                  Result,
+                                  *RetStmt.getValue(),
+                                  GetExprType(*RetStmt.getValue(), ValueMap),
+                                  *ReturnType);
+
+            if (!ConvOpt.has_value()) {
+                return std::nullopt;
+            }
+
+            Result = ConvOpt.value();
+        }
+
+        return Builder.CreateRet(Result);
     }
 
     auto
@@ -451,19 +1098,56 @@ namespace Backend::LLVM {
         }
 
         const auto Operand = OperandOpt.value();
+        const auto &Type = GetExprType(UnaryOp.getOperand(), ValueMap);
+
         switch (UnaryOp.getOperator()) {
             case Parse::UnaryOperator::Negate:
+                if (Type.isFloatingPoint()) {
+                    return Builder.CreateFNeg(Operand);
+                }
+
                 return Builder.CreateNeg(Operand);
             case Parse::UnaryOperator::LogicalNot:
-                assert(false && "Logical-Not not yet supported");
+                return Builder.CreateNot(
+                    ConvertValue(Builder,
+                                 Operand,
+                                 Type,
+                                 Sema::BuiltinType::boolType()));
             case Parse::UnaryOperator::BitwiseNot:
+                if (Type.isFloatingPoint()) {
+                    Handler.getDiag().consume({
+                        .Level = DiagnosticLevel::Error,
+                        .Location = UnaryOp.getLoc(),
+                        .Message =
+                            std::format("Bitwise operator needs an integer "
+                                        "operand, not \"{}\"",
+                                        Type.getName())
+                    });
+
+                    return std::nullopt;
+                }
+
                 return Builder.CreateNot(Operand);
             case Parse::UnaryOperator::Increment: {
+                if (Type.isFloatingPoint()) {
+                    const auto Value =
+                        llvm::ConstantFP::get(Operand->getType(), 1.0);
+
+                    return Builder.CreateFAdd(Operand, Value);
+                }
+
                 const auto Value =
                     llvm::ConstantInt::get(Operand->getType(), 1);
                 return Builder.CreateAdd(Operand, Value);
             }
             case Parse::UnaryOperator::Decrement: {
+                if (Type.isFloatingPoint()) {
+                    const auto Value =
+                        llvm::ConstantFP::get(Operand->getType(), 1.0);
+
+                    return Builder.CreateFSub(Operand, Value);
+                }
+
                 const auto Value =
                     llvm::ConstantInt::get(Operand->getType(), 1);
 
@@ -494,35 +1178,39 @@ namespace Backend::LLVM {
                    ValueMap &ValueMap) noexcept
         -> std::optional<llvm::Value *>
     {
-        if (ValueMap.getValue(VarDecl.getName()) != nullptr) {
-            Handler.getDiag().consume({
-                .Level = DiagnosticLevel::Error,
-                .Location = VarDecl.getNameLoc(),
-                .Message =
-                    std::format("Variable \'{}\' is already defined",
-                                VarDecl.getName())
-            });
+        // Sema has already reported variables declared twice.
+        const auto InitExpr = VarDecl.getInitExpr();
+        const auto Type =
+            VarDecl.hasInferredType() && InitExpr != nullptr ?
+                &GetExprType(*InitExpr, ValueMap) :
+                ResolveTypeExpr(VarDecl.getTypeExpr(), Handler);
+
+        if (Type == nullptr) {
+            return std::nullopt;
+        }
 
+        const auto LLVMType =
+            GetLLVMTypeOrDiag(*Type, Handler, VarDecl.getNameLoc());
+
+        if (LLVMType == nullptr) {
             return std::nullopt;
         }
 
-        if (VarDecl.getInitExpr() == nullptr) {
-            const auto Type = llvm::Type::getDoubleTy(Handler.getContext());
+        if (InitExpr == nullptr) {
             const auto GV =
                 new llvm::GlobalVariable(
                     Handler.getModule(),
-                    Type,
+                    LLVMType,
                     /*isConstant=*/!VarDecl.getQualifiers().isMutable(),
                     llvm::GlobalVariable::LinkageTypes::ExternalLinkage,
                     /*Initializer=*/nullptr,
                     VarDecl.getName());
 
+            ValueMap.setType(VarDecl, *Type);
             return GV;
         }
 
-        const auto ResultOpt =
-            Handler.codegen(*VarDecl.getInitExpr(), Builder, ValueMap);
-
+        const auto ResultOpt = Handler.codegen(*InitExpr, Builder, ValueMap);
         if (!ResultOpt.has_value()) {
             return std::nullopt;
         }
@@ -532,11 +1220,23 @@ namespace Backend::LLVM {
             llvm::IRBuilder(&FuncParent->getEntryBlock(),
                             FuncParent->getEntryBlock().begin());
 
-        const auto DoubleTy = llvm::Type::getDoubleTy(Handler.getContext());
         const auto AllocaBlock =
-            TmpB.CreateAlloca(DoubleTy, nullptr, VarDecl.getName());
+            TmpB.CreateAlloca(LLVMType, nullptr, VarDecl.getName());
+
+        const auto ValueOpt =
+            ConvertImplicitly(Handler, Builder,
+                              ResultOpt.value(),
+                              *InitExpr,
+                              GetExprType(*InitExpr, ValueMap),
+                              *Type);
+
+        if (!ValueOpt.has_value()) {
+            return std::nullopt;
+        }
+
+        Builder.CreateStore(ValueOpt.value(), AllocaBlock);
+        ValueMap.setType(VarDecl, *Type);
 
-        Builder.CreateStore(ResultOpt.value(), AllocaBlock);
         return AllocaBlock;
     }
 
@@ -547,24 +1247,22 @@ namespace Backend::LLVM {
                        ValueMap &ValueMap) noexcept
         -> std::optional<llvm::Value *>
     {
-        if (const auto Value = ValueMap.getValue(DeclRef.getName())) {
+        if (const auto Value = ValueMap.getValue(DeclRef)) {
             if (const auto AllocaInst = llvm::dyn_cast<llvm::AllocaInst>(Value))
             {
                 return
-                    Builder.CreateLoad(
-                        llvm::Type::getDoubleTy(Handler.getContext()),
-                        AllocaInst,
-                        "loadedValue");
+                    Builder.CreateLoad(AllocaInst->getAllocatedType(),
+                                       AllocaInst,
+                                       "loadedValue");
             }
 
             if (const auto GlobalVar =
                     llvm::dyn_cast<llvm::GlobalVariable>(Value))
             {
                 return
-                    Builder.CreateLoad(
-                        llvm::Type::getDoubleTy(Handler.getContext()),
-                        GlobalVar,
-                        "loadedValue");
+                    Builder.CreateLoad(GlobalVar->getValueType(),
+                                       GlobalVar,
+                                       "loadedValue");
             }
 
             return Value;
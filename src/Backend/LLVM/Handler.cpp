@@ -2,6 +2,7 @@
  * Backend/LLVM/Handler.cpp
  */
 
+#include <cassert>
 #include <memory>
 
 #include "Backend/LLVM/Handler.h"
@@ -17,9 +18,15 @@
 
 namespace Backend::LLVM {
     void Handler::initializeLLVM() noexcept {
-        llvm::InitializeNativeTarget();
-        llvm::InitializeNativeTargetAsmParser();
-        llvm::InitializeNativeTargetAsmPrinter();
+        static const auto Initialized = []() noexcept {
+            llvm::InitializeNativeTarget();
+            llvm::InitializeNativeTargetAsmParser();
+            llvm::InitializeNativeTargetAsmPrinter();
+
+            return true;
+        }();
+
+        (void)Initialized;
     }
 
     void Handler::allocCoreFields(const llvm::StringRef &Name) noexcept {
@@ -74,59 +81,143 @@ namespace Backend::LLVM {
     Handler::Handler(DiagnosticConsumer  &Diag) noexcept
     : Handler("Compiler", Diag) {}
 
-    auto
-    ValueMap::add(const std::string_view Name,
-                       llvm::Value *const Value) noexcept -> decltype(*this)
+    void ValueMap::beginFunction(const AST::FunctionDecl &FuncDecl) noexcept {
+        const auto SlotCount = FuncDecl.getSlotCount();
+        if (this->FunctionDepth++ == 0) {
+            this->SlotList.assign(SlotCount, Entry());
+        } else if (this->SlotList.size() < SlotCount) {
+            this->SlotList.resize(SlotCount);
+        }
+    }
+
+    void ValueMap::endFunction() noexcept {
+        this->FunctionDepth--;
+    }
+
+    auto ValueMap::getEntry(const AST::LvalueNamedDecl &Decl) noexcept
+        -> Entry &
     {
-        if (const auto Iter = this->Map.find(Name); Iter != this->Map.end()) {
-            Iter->second.push_back(Value);
-        } else {
-            this->Map.insert({ std::string(Name), std::vector({Value}) });
+        if (Decl.hasSlot()) {
+            assert(Decl.getSlot() < this->SlotList.size() &&
+                   "Local declared outside of its function");
+
+            return this->SlotList[Decl.getSlot()];
         }
 
-        return *this;
+        return this->GlobalMap[&Decl];
+    }
+
+    auto ValueMap::getEntry(const AST::LvalueNamedDecl &Decl) const noexcept
+        -> const Entry *
+    {
+        if (Decl.hasSlot()) {
+            if (Decl.getSlot() < this->SlotList.size()) {
+                return &this->SlotList[Decl.getSlot()];
+            }
+
+            return nullptr;
+        }
+
+        const auto Iter = this->GlobalMap.find(&Decl);
+        if (Iter != this->GlobalMap.end()) {
+            return &Iter->second;
+        }
+
+        return nullptr;
     }
 
     auto
-    ValueMap::setValue(const std::string_view Name,
+    ValueMap::setValue(const AST::LvalueNamedDecl &Decl,
                        llvm::Value *const Value) noexcept -> decltype(*this)
     {
-        if (const auto Iter = this->Map.find(Name); Iter != this->Map.end()) {
-            Iter->second.clear();
-            Iter->second.push_back(Value);
+        this->getEntry(Decl).Value = Value;
+        return *this;
+    }
 
-            return *this;
+    auto ValueMap::getValue(const AST::LvalueNamedDecl &Decl) const noexcept
+        -> llvm::Value *
+    {
+        if (const auto Entry = this->getEntry(Decl)) {
+            return Entry->Value;
         }
 
-        this->Map.insert({ std::string(Name), std::vector({Value}) });
-        return *this;
+        return nullptr;
     }
 
-    auto ValueMap::getValue(const std::string_view Name) const noexcept
+    auto ValueMap::getValue(const AST::DeclRefExpr &Expr) const noexcept
         -> llvm::Value *
     {
-        if (const auto Iter = this->Map.find(Name); Iter != this->Map.end()) {
-            return Iter->second.back();
+        if (const auto Decl =
+                llvm::dyn_cast_if_present<AST::LvalueNamedDecl>(
+                    Expr.getDecl()))
+        {
+            return this->getValue(*Decl);
         }
 
         return nullptr;
     }
 
-    auto ValueMap::removeValue(const std::string_view Name) noexcept
+    auto
+    ValueMap::setType(const AST::LvalueNamedDecl &Decl,
+                      const Sema::BuiltinType &Type) noexcept
         -> decltype(*this)
     {
-        if (const auto Iter = this->Map.find(Name); Iter != this->Map.end()) {
-            Iter->second.pop_back();
-            if (Iter->second.empty()) {
-                Map.erase(Iter);
+        this->getEntry(Decl).Type = &Type;
+        return *this;
+    }
+
+    auto ValueMap::getType(const AST::DeclRefExpr &Expr) const noexcept
+        -> const Sema::BuiltinType *
+    {
+        if (const auto Decl =
+                llvm::dyn_cast_if_present<AST::LvalueNamedDecl>(
+                    Expr.getDecl()))
+        {
+            if (const auto Entry = this->getEntry(*Decl)) {
+                return Entry->Type;
             }
         }
 
+        return nullptr;
+    }
+
+    auto
+    ValueMap::setReturnType(const llvm::Function &Function,
+                            const Sema::BuiltinType &Type) noexcept
+        -> decltype(*this)
+    {
+        this->ReturnTypeMap[&Function] = &Type;
+        return *this;
+    }
+
+    auto
+    ValueMap::getReturnType(const llvm::Function &Function) const noexcept
+        -> const Sema::BuiltinType *
+    {
+        return this->ReturnTypeMap.lookup(&Function);
+    }
+
+    auto
+    ValueMap::setExprType(const AST::Expr &Expr,
+                          const Sema::BuiltinType &Type) noexcept
+        -> decltype(*this)
+    {
+        this->ExprTypeMap[&Expr] = &Type;
         return *this;
     }
 
+    auto ValueMap::getExprType(const AST::Expr &Expr) const noexcept
+        -> const Sema::BuiltinType *
+    {
+        return this->ExprTypeMap.lookup(&Expr);
+    }
+
     auto ValueMap::clear() noexcept -> decltype(*this) {
-        this->Map.clear();
+        this->SlotList.clear();
+        this->GlobalMap.clear();
+        this->ReturnTypeMap.clear();
+        this->ExprTypeMap.clear();
+
         return *this;
     }
 
@@ -177,7 +268,7 @@ namespace Backend::LLVM {
                     return false;
                 }
 
-                ValueMap.add(Name, FuncDeclCodegenOpt.value());
+                ValueMap.setValue(*Decl, FuncDeclCodegenOpt.value());
                 continue;
             }
 
@@ -185,7 +276,7 @@ namespace Backend::LLVM {
                     this->codegen(*Decl, this->getBuilder(), ValueMap))
             {
                 addASTNode(Name, *Decl);
-                ValueMap.add(Name, ValueOpt.value());
+                ValueMap.setValue(*Decl, ValueOpt.value());
 
                 continue;
             }
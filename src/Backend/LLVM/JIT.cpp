@@ -13,6 +13,7 @@
 #include "llvm/Passes/PassBuilder.h"
 
 #include "llvm/Transforms/InstCombine/InstCombine.h"
+#include "llvm/Transforms/IPO/MergeFunctions.h"
 #include "llvm/Transforms/Scalar/GVN.h"
 #include "llvm/Transforms/Scalar/Reassociate.h"
 #include "llvm/Transforms/Scalar/SimplifyCFG.h"
@@ -52,6 +53,22 @@ namespace Backend::LLVM {
         return std::move(TSM);
     }
 
+    // Functions whose code is the same, once each has been optimized, are
+    // merged into one, with the others calling through to it. This has to
+    // happen before the module is split up to be compiled lazily, as each
+    // part only has the one function that was asked for.
+
+    static void MergeIdenticalFunctions(llvm::Module &M) noexcept {
+        auto MAM = llvm::ModuleAnalysisManager();
+        auto PB = llvm::PassBuilder();
+
+        PB.registerModuleAnalyses(MAM);
+
+        auto MPM = llvm::ModulePassManager();
+        MPM.addPass(llvm::MergeFunctionsPass());
+        MPM.run(M, MAM);
+    }
+
     JITHandler::JITHandler(
         DiagnosticConsumer &Diag,
         const Parse::ParseUnit &Unit,
@@ -119,6 +136,22 @@ namespace Backend::LLVM {
         }
     }
 
+    auto
+    JITHandler::addModule(llvm::orc::ThreadSafeModule TSM,
+                          llvm::orc::ResourceTrackerSP RT) noexcept
+        -> llvm::Error
+    {
+        if (RT == nullptr) {
+            RT = this->MainJD.getDefaultResourceTracker();
+        }
+
+        TSM.withModuleDo([](llvm::Module &M) noexcept {
+            MergeIdenticalFunctions(M);
+        });
+
+        return this->CODLayer.add(RT, std::move(TSM));
+    }
+
     auto
     JITHandler::Create(DiagnosticConsumer &Diag,
                        const Parse::ParseUnit &Unit) noexcept
@@ -206,7 +239,7 @@ namespace Backend::LLVM {
                     return false;
                 }
 
-                ValueMap.setValue("FIXME_Name", FuncCodegenOpt.value());
+                ValueMap.setValue(*ValDecl, FuncCodegenOpt.value());
                 continue;
             }
 
@@ -221,7 +254,7 @@ namespace Backend::LLVM {
                     return false;
                 }
 
-                ValueMap.add(VarDecl->getName(), CodegenOpt.value());
+                ValueMap.setValue(*VarDecl, CodegenOpt.value());
                 continue;
             }
         }
@@ -276,7 +309,10 @@ namespace Backend::LLVM {
                                  const std::string_view Prefix,
                                  const std::string_view Suffix) noexcept
     {
-        auto ValueMap = this->ValueMap;
+        // Every prompt is generated into a new module, so values from the
+        // last prompt can't be used.
+
+        auto &ValueMap = this->ValueMap.clear();
         // FIXME:
         #if 0
         if (const auto FuncDecl = llvm::dyn_cast<AST::FunctionDecl>(&Stmt)) {
@@ -318,9 +354,12 @@ namespace Backend::LLVM {
             }
 
             if (const auto VarDecl = llvm::dyn_cast<AST::VarDecl>(&Stmt)) {
-                StmtToExecute =
+                const auto DeclRef =
                     new AST::DeclRefExpr(VarDecl->getName(),
                                          VarDecl->getNameLoc());
+
+                DeclRef->setDecl(VarDecl);
+                StmtToExecute = DeclRef;
             }
 
             this->addASTNode(Name, *Decl);
@@ -337,16 +376,34 @@ namespace Backend::LLVM {
         }
 
         const auto Name = llvm::StringRef("__anon_expr");
+        const auto Expr = static_cast<AST::Expr *>(StmtToExecute);
         const auto ReturnStmt =
             std::unique_ptr<AST::ReturnStmt>(
                 new AST::ReturnStmt(/*ReturnLoc=*/SourceLocation::invalid(),
-                                    static_cast<AST::Expr *>(StmtToExecute)));
+                                    Expr));
+
+        // The expression is returned widened to a 64-bit type of its kind,
+        // so there's one function pointer type to call it through for each.
+
+        const auto &ResultType = GetExprType(*Expr, ValueMap);
+        auto ReturnTypeName = std::string_view("f64");
+
+        if (ResultType.isBool()) {
+            ReturnTypeName = "bool";
+        } else if (ResultType.isSignedInteger()) {
+            ReturnTypeName = "s64";
+        } else if (ResultType.isInteger()) {
+            ReturnTypeName = "u64";
+        }
+
+        auto ReturnTypeExpr =
+            AST::DeclRefExpr(ReturnTypeName, SourceLocation::invalid());
 
         auto FuncDecl =
             AST::FunctionDecl(/*Loc=*/SourceLocation::invalid(),
                               AST::Qualifiers(),
                               std::vector<AST::Stmt *>(),
-                              /*ReturnTypeExpr=*/nullptr,
+                              &ReturnTypeExpr,
                               ReturnStmt.get());
 
         const auto FuncDeclCodegenOpt =
@@ -383,9 +440,22 @@ namespace Backend::LLVM {
         const auto ExprSymbol = ExitOnErr(this->lookup(Name));
 
         // Get the symbol's address and cast it to the right type (takes no
-        // arguments, returns a double) so we can call it as a native function.
-        double (*const FP)() = ExprSymbol.toPtr<double (*)()>();
-        std::print(stdout, "{}{}{}", Prefix, FP(), Suffix);
+        // arguments, returns the widened result) so we can call it as a
+        // native function.
+
+        if (ResultType.isBool()) {
+            const auto FP = ExprSymbol.toPtr<bool (*)()>();
+            std::print(stdout, "{}{}{}", Prefix, FP(), Suffix);
+        } else if (ResultType.isSignedInteger()) {
+            const auto FP = ExprSymbol.toPtr<int64_t (*)()>();
+            std::print(stdout, "{}{}{}", Prefix, FP(), Suffix);
+        } else if (ResultType.isInteger()) {
+            const auto FP = ExprSymbol.toPtr<uint64_t (*)()>();
+            std::print(stdout, "{}{}{}", Prefix, FP(), Suffix);
+        } else {
+            const auto FP = ExprSymbol.toPtr<double (*)()>();
+            std::print(stdout, "{}{}{}", Prefix, FP(), Suffix);
+        }
 
         // Delete the anonymous expression module from the JIT.
         ExitOnErr(RT->remove());
@@ -0,0 +1,484 @@
+/*
+ * Lex/ParseNumber.cpp
+ * © suhas pai
+ */
+
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include "Lex/ParseNumber.h"
+
+namespace Lex {
+    // Literals are converted eight characters at a time by treating the
+    // characters as the bytes of a single 64-bit integer (SWAR). The helpers
+    // below expect the first character of the chunk in the lowest byte.
+
+    [[nodiscard]]
+    static inline auto LoadEightChars(const char *const Ptr) noexcept {
+        auto Result = uint64_t();
+        std::memcpy(&Result, Ptr, sizeof(Result));
+
+        if constexpr (std::endian::native == std::endian::big) {
+            Result = std::byteswap(Result);
+        }
+
+        return Result;
+    }
+
+    [[nodiscard]]
+    constexpr static auto SWARRepeat(const uint8_t Byte) noexcept {
+        return uint64_t(0x0101010101010101) * Byte;
+    }
+
+    // Returns a mask with 0x80 set in every byte of Bytes within [Lo, Hi].
+    // Every byte of Bytes must be below 0x80, so no addition carries into the
+    // next byte.
+
+    [[nodiscard]] constexpr static auto
+    SWARBytesInRange(const uint64_t Bytes,
+                     const uint8_t Lo,
+                     const uint8_t Hi) noexcept
+    {
+        const auto AtLeastLo = Bytes + SWARRepeat(0x80 - Lo);
+        const auto AboveHi = Bytes + SWARRepeat(0x7F - Hi);
+
+        return AtLeastLo & ~AboveHi & SWARRepeat(0x80);
+    }
+
+    [[nodiscard]] constexpr static auto
+    SWARParseEightDecimalDigits(uint64_t Bytes) noexcept
+        -> std::optional<uint32_t>
+    {
+        if ((Bytes & SWARRepeat(0x80)) != 0 ||
+            SWARBytesInRange(Bytes, '0', '9') != SWARRepeat(0x80))
+        {
+            return std::nullopt;
+        }
+
+        // Combine neighbouring digits into pairs, then pairs into groups of
+        // four, then the two groups of four.
+
+        Bytes -= SWARRepeat('0');
+        Bytes = (Bytes * 10 + (Bytes >> 8)) & 0x00FF00FF00FF00FF;
+        Bytes = (Bytes * 100 + (Bytes >> 16)) & 0x0000FFFF0000FFFF;
+        Bytes = (Bytes * 10000 + (Bytes >> 32)) & 0xFFFFFFFF;
+
+        return static_cast<uint32_t>(Bytes);
+    }
+
+    [[nodiscard]] constexpr static auto
+    SWARParseEightHexDigits(const uint64_t Bytes) noexcept
+        -> std::optional<uint32_t>
+    {
+        if ((Bytes & SWARRepeat(0x80)) != 0) {
+            return std::nullopt;
+        }
+
+        // Setting 0x20 lowercases letters and leaves digits as-is.
+        const auto IsDigit = SWARBytesInRange(Bytes, '0', '9');
+        const auto IsLetter =
+            SWARBytesInRange(Bytes | SWARRepeat(0x20), 'a', 'f');
+
+        if ((IsDigit | IsLetter) != SWARRepeat(0x80)) {
+            return std::nullopt;
+        }
+
+        // Move the first character into the highest byte, so the nibbles are
+        // packed most-significant first.
+
+        auto Nibbles =
+            std::byteswap((Bytes & SWARRepeat(0x0F)) + (IsLetter >> 7) * 9);
+
+        Nibbles = (Nibbles | Nibbles >> 4) & 0x00FF00FF00FF00FF;
+        Nibbles = (Nibbles | Nibbles >> 8) & 0x0000FFFF0000FFFF;
+        Nibbles = (Nibbles | Nibbles >> 16) & 0xFFFFFFFF;
+
+        return static_cast<uint32_t>(Nibbles);
+    }
+
+    [[nodiscard]] constexpr static auto
+    SWARParseEightBinaryDigits(const uint64_t Bytes) noexcept
+        -> std::optional<uint8_t>
+    {
+        if ((Bytes & SWARRepeat(0x80)) != 0 ||
+            SWARBytesInRange(Bytes, '0', '1') != SWARRepeat(0x80))
+        {
+            return std::nullopt;
+        }
+
+        // The multiply gathers the low bit of every byte into the top byte.
+        const auto Bits = std::byteswap(Bytes & SWARRepeat(0x01));
+        return static_cast<uint8_t>((Bits * 0x0102040810204080) >> 56);
+    }
+
+    [[nodiscard]] constexpr static auto DigitGetValue(const char Char) noexcept
+        -> uint8_t
+    {
+        switch (Char) {
+            case '0'...'9':
+                return Char - '0';
+            case 'a'...'z':
+                return Char - 'a' + 10;
+            case 'A'...'Z':
+                return Char - 'A' + 10;
+        }
+
+        return UINT8_MAX;
+    }
+
+    // Accumulates the digits of Base starting at Index into Value, and stops
+    // at the first character that isn't such a digit. Returns false if Value
+    // overflowed.
+
+    [[nodiscard]] static auto
+    ParseDigits(const std::string_view Text,
+                const uint8_t Base,
+                uint64_t &Index,
+                uint64_t &Value) noexcept -> bool
+    {
+        // A chunk containing a non-digit falls through to the scalar loop,
+        // which finds exactly where the digits end.
+
+        while (Text.size() - Index >= 8) {
+            const auto Bytes = LoadEightChars(Text.data() + Index);
+            if (Base == 10) {
+                const auto Chunk = SWARParseEightDecimalDigits(Bytes);
+                if (!Chunk.has_value()) {
+                    break;
+                }
+
+                if (__builtin_mul_overflow(Value, 100'000'000, &Value) ||
+                    __builtin_add_overflow(Value, Chunk.value(), &Value))
+                {
+                    return false;
+                }
+            } else if (Base == 16) {
+                const auto Chunk = SWARParseEightHexDigits(Bytes);
+                if (!Chunk.has_value()) {
+                    break;
+                }
+
+                if ((Value >> 32) != 0) {
+                    return false;
+                }
+
+                Value = Value << 32 | Chunk.value();
+            } else if (Base == 2) {
+                const auto Chunk = SWARParseEightBinaryDigits(Bytes);
+                if (!Chunk.has_value()) {
+                    break;
+                }
+
+                if ((Value >> 56) != 0) {
+                    return false;
+                }
+
+                Value = Value << 8 | Chunk.value();
+            } else {
+                break;
+            }
+
+            Index += 8;
+        }
+
+        for (; Index != Text.size(); Index++) {
+            const auto Digit = DigitGetValue(Text[Index]);
+            if (Digit >= Base) {
+                break;
+            }
+
+            if (__builtin_mul_overflow(Value, Base, &Value) ||
+                __builtin_add_overflow(Value, Digit, &Value))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static auto
+    CountDecimalDigits(const std::string_view Text, uint64_t Index) noexcept {
+        const auto Begin = Index;
+        while (Index != Text.size() && Text[Index] >= '0' && Text[Index] <= '9')
+        {
+            Index++;
+        }
+
+        return Index - Begin;
+    }
+
+    constexpr static auto ExactPowerOfTenList = std::array<double, 23>({
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    });
+
+    // Parses a decimal floating-point literal whose digits start at Index.
+    // When the significand fits in 53 bits and the power of ten is at most 22,
+    // both are exactly representable, so a single multiply or divide gives a
+    // correctly rounded result. Other literals go through strtod().
+
+    static auto
+    ParseFloatingPoint(const std::string_view Text,
+                       uint64_t Index,
+                       const bool IsNegative,
+                       ParseNumberResult &Result) noexcept
+    {
+        const auto Begin = Index;
+        const auto IntDigitCount = CountDecimalDigits(Text, Index);
+
+        auto FracDigitCount = uint64_t();
+        if (Index + IntDigitCount != Text.size() &&
+            Text[Index + IntDigitCount] == '.')
+        {
+            FracDigitCount =
+                CountDecimalDigits(Text, Index + IntDigitCount + 1);
+        }
+
+        auto Significand = uint64_t();
+        auto CanUseFastPath = IntDigitCount + FracDigitCount <= 19;
+
+        if (CanUseFastPath) {
+            // 19 digits always fit in 64 bits, so neither call overflows.
+            const auto IntEnd = Index + IntDigitCount;
+            if (!ParseDigits(Text.substr(0, IntEnd), 10, Index, Significand)) {
+                __builtin_unreachable();
+            }
+
+            if (FracDigitCount != 0) {
+                const auto FracEnd = ++Index + FracDigitCount;
+                if (!ParseDigits(Text.substr(0, FracEnd), 10, Index,
+                                 Significand))
+                {
+                    __builtin_unreachable();
+                }
+            }
+        } else {
+            Index += IntDigitCount;
+            if (FracDigitCount != 0) {
+                Index += FracDigitCount + 1;
+            }
+        }
+
+        if (Index != Text.size() && Text[Index] == '.') {
+            Index++;
+        }
+
+        auto Exponent = -static_cast<int64_t>(FracDigitCount);
+        if (Index != Text.size() && (Text[Index] == 'e' || Text[Index] == 'E'))
+        {
+            Index++;
+
+            auto ExponentIsNegative = false;
+            if (Index != Text.size() &&
+                (Text[Index] == '+' || Text[Index] == '-'))
+            {
+                ExponentIsNegative = Text[Index] == '-';
+                Index++;
+            }
+
+            if (CountDecimalDigits(Text, Index) == 0) {
+                Result.Error.Kind = ParseNumberErrorKind::InvalidDigit;
+                Result.Error.IndexOfInvalid = Index;
+
+                return;
+            }
+
+            auto ExplicitExponent = int64_t();
+            for (; Index != Text.size() &&
+                   Text[Index] >= '0' && Text[Index] <= '9'; Index++)
+            {
+                // Larger exponents over- or underflow regardless, so stop
+                // accumulating before ExplicitExponent itself overflows.
+
+                if (ExplicitExponent < 100'000) {
+                    ExplicitExponent =
+                        ExplicitExponent * 10 + (Text[Index] - '0');
+                }
+            }
+
+            Exponent +=
+                ExponentIsNegative ? -ExplicitExponent : ExplicitExponent;
+        }
+
+        if (Index != Text.size()) {
+            const auto Char = Text[Index];
+            if (DigitGetValue(Char) != UINT8_MAX) {
+                Result.Error.Kind = ParseNumberErrorKind::InvalidDigit;
+            } else {
+                Result.Error.Kind = ParseNumberErrorKind::UnrecognizedChar;
+            }
+
+            Result.Error.IndexOfInvalid = Index;
+            return;
+        }
+
+        auto Value = double();
+        CanUseFastPath =
+            CanUseFastPath &&
+            Significand <= (uint64_t(1) << 53) &&
+            Exponent >= -22 && Exponent <= 22;
+
+        if (CanUseFastPath) {
+            Value = static_cast<double>(Significand);
+            if (Exponent < 0) {
+                Value /= ExactPowerOfTenList[-Exponent];
+            } else {
+                Value *= ExactPowerOfTenList[Exponent];
+            }
+        } else {
+            const auto String = std::string(Text.substr(Begin));
+
+            errno = 0;
+            Value = std::strtod(String.c_str(), nullptr);
+
+            if (errno == ERANGE && Value != 0) {
+                Result.Error.Kind = ParseNumberErrorKind::TooLarge;
+                return;
+            }
+        }
+
+        Result.Success.Kind = NumberKind::FloatingPoint;
+        Result.Success.Float64 = IsNegative ? -Value : Value;
+    }
+
+    auto
+    ParseNumber(const std::string_view Text,
+                const ParseNumberOptions Options) noexcept -> ParseNumberResult
+    {
+        auto Result = ParseNumberResult();
+        if (Text.empty()) {
+            Result.Error.Kind = ParseNumberErrorKind::EmptyString;
+            return Result;
+        }
+
+        auto Index = uint64_t();
+        auto IsNegative = false;
+
+        Result.Success.Kind = NumberKind::UnsignedInteger;
+        if (Text.front() == '-') {
+            if (Options.DontAllowNegativeNumbers) {
+                Result.Error.Kind = ParseNumberErrorKind::NegativeNumber;
+                return Result;
+            }
+
+            Index++;
+            IsNegative = true;
+        } else if (Text.front() == '+') {
+            if (!Options.AllowPositiveSign) {
+                Result.Error.Kind = ParseNumberErrorKind::PositiveSign;
+                return Result;
+            }
+
+            Index++;
+        }
+
+        if (Index == Text.size()) {
+            Result.Error.Kind = ParseNumberErrorKind::EmptyString;
+            return Result;
+        }
+
+        auto Base = uint8_t(10);
+        if (Text[Index] == '0' && Index + 1 != Text.size()) {
+            switch (Text[Index + 1]) {
+                case 'b':
+                case 'B':
+                    Index += 2;
+                    Base = 2;
+
+                    break;
+                case 'o':
+                case 'O':
+                    Index += 2;
+                    Base = 8;
+
+                    break;
+                case 'x':
+                case 'X':
+                    Index += 2;
+                    Base = 16;
+
+                    break;
+                case '.':
+                case 'e':
+                case 'E':
+                case 's':
+                case 'S':
+                case 'u':
+                case 'U':
+                    break;
+                default:
+                    Result.Error.Kind = ParseNumberErrorKind::UnrecognizedBase;
+                    Result.Error.IndexOfInvalid = Index + 1;
+
+                    return Result;
+            }
+        }
+
+        if (Base == 10 && Text.find_first_of(".eE", Index) != Text.npos) {
+            ParseFloatingPoint(Text, Index, IsNegative, Result);
+            return Result;
+        }
+
+        auto Value = uint64_t();
+        if (!ParseDigits(Text, Base, Index, Value)) {
+            Result.Error.Kind = ParseNumberErrorKind::Overflow;
+            Result.Error.IndexOfInvalid = Index;
+
+            return Result;
+        }
+
+        if (Index != Text.size()) {
+            switch (Text[Index]) {
+                case 's':
+                case 'S':
+                case 'u':
+                case 'U':
+                    Result.Success.Suffix = Text.substr(Index);
+                    break;
+                case '.':
+                    Result.Error.Kind = ParseNumberErrorKind::FloatingPoint;
+                    Result.Error.IndexOfInvalid = Index;
+
+                    return Result;
+                default:
+                    if (DigitGetValue(Text[Index]) != UINT8_MAX) {
+                        Result.Error.Kind = ParseNumberErrorKind::InvalidDigit;
+                    } else {
+                        Result.Error.Kind =
+                            ParseNumberErrorKind::UnrecognizedChar;
+                    }
+
+                    Result.Error.IndexOfInvalid = Index;
+                    return Result;
+            }
+        }
+
+        if (IsNegative) {
+            if (Value == 0) {
+                Result.Error.Kind = ParseNumberErrorKind::NegativeZero;
+                return Result;
+            }
+
+            if (Value > static_cast<uint64_t>(INT64_MAX) + 1) {
+                Result.Error.Kind = ParseNumberErrorKind::Overflow;
+                Result.Error.IndexOfInvalid = Index;
+
+                return Result;
+            }
+
+            Result.Success.Kind = NumberKind::SignedInteger;
+            Result.Success.SInt = static_cast<int64_t>(0 - Value);
+
+            return Result;
+        }
+
+        Result.Success.UInt = Value;
+        return Result;
+    }
+}
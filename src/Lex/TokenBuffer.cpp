@@ -3,41 +3,523 @@
  * © suhas pai
  */
 
+#include <algorithm>
+#include <thread>
+
 #include "Lex/TokenBuffer.h"
 #include "Lex/Tokenizer.h"
 
 namespace Lex {
-    auto
-    TokenBuffer::Create(const ADT::SourceBuffer &SrcBuffer,
-                        DiagnosticConsumer &Diag) noexcept
-        -> std::optional<TokenBuffer>
+    // The tokens of a piece of a source-buffer. Locations are relative to the
+    // start of the piece until the piece is merged into a TokenBuffer.
+
+    struct LexedChunk {
+        uint32_t Begin = 0;
+        uint32_t End = 0;
+        uint32_t RowCount = 0;
+
+        bool Failed : 1 = false;
+
+        std::vector<LineInfo> LineInfoList;
+        std::vector<Token> TokenList;
+        std::vector<TokenBuffer::NumberInfo> NumberInfoList;
+
+        BufferedDiagnosticConsumer Diag = BufferedDiagnosticConsumer();
+    };
+
+    static void
+    LexChunk(const std::string_view Text,
+             DiagnosticConsumer &Diag,
+             LexedChunk &Chunk) noexcept
     {
-        auto Tokenizer = Lex::Tokenizer(SrcBuffer.text(), Diag);
+        auto Tokenizer = Lex::Tokenizer(Text, Diag);
         auto [Token, LineInfo] = Tokenizer.next();
 
         auto CurrentLineInfo = LineInfo;
-        auto LineInfoList = std::vector<Lex::LineInfo>({ CurrentLineInfo });
-        auto TokenList = std::vector<Lex::Token>();
+        Chunk.LineInfoList.emplace_back(CurrentLineInfo);
 
         while (!Token.isEof()) {
-            TokenList.emplace_back(Token);
+            Chunk.TokenList.emplace_back(Token);
+            if (Token.Kind == TokenKind::IntegerLiteral ||
+                Token.Kind == TokenKind::FloatLiteral)
+            {
+                // Convert the literal while its text is still in cache.
+                Chunk.NumberInfoList.emplace_back(TokenBuffer::NumberInfo {
+                    .Index = Token.Loc.Index,
+                    .Result = Lex::ParseNumber(Token.getString(Text))
+                });
+            }
+
             const auto Next = Tokenizer.next();
 
             Token = Next.first;
             LineInfo = Next.second;
 
             if (Token.isInvalid()) {
-                TokenList.clear();
-                return std::nullopt;
+                Chunk.Failed = true;
+                return;
             }
 
             if (CurrentLineInfo.ByteOffset != LineInfo.ByteOffset) {
-                LineInfoList.emplace_back(LineInfo);
+                Chunk.LineInfoList.emplace_back(LineInfo);
                 CurrentLineInfo = LineInfo;
             }
         }
 
-        return TokenBuffer(SrcBuffer, std::move(LineInfoList),
-                           std::move(TokenList));
+        Chunk.RowCount = Tokenizer.getLoc().Row;
+    }
+
+    // Below this many bytes, starting threads costs more than it saves.
+    constexpr static auto ParallelLexMinSize = 1 << 20;
+
+    // Find offsets that split Text into ChunkCount pieces of about equal size.
+    // Each piece starts at the beginning of a line that isn't inside a string
+    // or char literal, so no token crosses from one piece into the next, and
+    // the tokenizer is in its start state at each offset.
+
+    static auto
+    FindChunkBoundaries(const std::string_view Text,
+                        const uint32_t ChunkCount) noexcept
+        -> std::vector<uint32_t>
+    {
+        auto Result = std::vector<uint32_t>();
+        Result.reserve(ChunkCount);
+
+        const auto TargetSize = static_cast<uint32_t>(Text.size() / ChunkCount);
+
+        auto Next = TargetSize;
+        auto Quote = '\0';
+
+        for (auto I = uint32_t(); I < Text.size(); I++) {
+            const auto Char = Text[I];
+            if (Quote != '\0') {
+                // Match the tokenizer, which skips the character following a
+                // backslash in a literal.
+
+                if (Char == '\\') {
+                    I++;
+                } else if (Char == Quote) {
+                    Quote = '\0';
+                }
+
+                continue;
+            }
+
+            switch (Char) {
+                case '"':
+                case '\'':
+                    Quote = Char;
+                    break;
+                case '\n':
+                    if (I + 1 >= Next && I + 1 != Text.size()) {
+                        Result.emplace_back(I + 1);
+                        Next = I + 1 + TargetSize;
+                    }
+
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        return Result;
+    }
+
+    // Appends the tokens of Chunk to Result, moving their locations by the
+    // position of Chunk in the source-buffer.
+
+    static void
+    MergeChunk(LexedChunk &Result,
+               const LexedChunk &Chunk,
+               const uint32_t RowOffset) noexcept
+    {
+        const auto IndexOffset = Chunk.Begin;
+        for (auto LineInfo : Chunk.LineInfoList) {
+            LineInfo.ByteOffset += IndexOffset;
+            if (Result.LineInfoList.back().ByteOffset != LineInfo.ByteOffset) {
+                Result.LineInfoList.emplace_back(LineInfo);
+            }
+        }
+
+        Result.TokenList.reserve(Result.TokenList.size() +
+                                 Chunk.TokenList.size());
+
+        for (auto Token : Chunk.TokenList) {
+            Token.Loc.Index += IndexOffset;
+            Token.Loc.Row += RowOffset;
+            Token.End.Index += IndexOffset;
+            Token.End.Row += RowOffset;
+
+            Result.TokenList.emplace_back(Token);
+        }
+
+        for (auto NumberInfo : Chunk.NumberInfoList) {
+            NumberInfo.Index += IndexOffset;
+            Result.NumberInfoList.emplace_back(NumberInfo);
+        }
+    }
+
+    // Returns false if lexing in parallel was not worth it for this buffer, in
+    // which case nothing was added to Result.
+
+    static auto
+    LexInParallel(const std::string_view Text,
+                  DiagnosticConsumer &Diag,
+                  LexedChunk &Result) noexcept -> bool
+    {
+        const auto ThreadCount = std::thread::hardware_concurrency();
+        if (Text.size() < ParallelLexMinSize || ThreadCount < 2) {
+            return false;
+        }
+
+        const auto ChunkCount =
+            std::min(ThreadCount,
+                     static_cast<uint32_t>(Text.size() / ParallelLexMinSize));
+
+        const auto BoundaryList = FindChunkBoundaries(Text, ChunkCount);
+        if (BoundaryList.empty()) {
+            return false;
+        }
+
+        auto ChunkList = std::vector<LexedChunk>(BoundaryList.size() + 1);
+        auto Begin = uint32_t();
+
+        for (auto I = size_t(); I != BoundaryList.size(); I++) {
+            ChunkList[I].Begin = Begin;
+            ChunkList[I].End = BoundaryList[I];
+
+            Begin = BoundaryList[I];
+        }
+
+        ChunkList.back().Begin = Begin;
+        ChunkList.back().End = static_cast<uint32_t>(Text.size());
+
+        const auto LexChunkInWorker = [Text](LexedChunk &Chunk) noexcept {
+            LexChunk(Text.substr(Chunk.Begin, Chunk.End - Chunk.Begin),
+                     Chunk.Diag, Chunk);
+        };
+
+        auto ThreadList = std::vector<std::thread>();
+        ThreadList.reserve(ChunkList.size() - 1);
+
+        for (auto &Chunk : std::span(ChunkList).subspan(1)) {
+            ThreadList.emplace_back(LexChunkInWorker, std::ref(Chunk));
+        }
+
+        LexChunkInWorker(ChunkList.front());
+        for (auto &Thread : ThreadList) {
+            Thread.join();
+        }
+
+        // Merge in source order. A chunk that failed to lex stops the merge
+        // at the same place lexing on a single thread would have stopped.
+
+        auto RowOffset = uint32_t();
+        for (auto &Chunk : ChunkList) {
+            Chunk.Diag.shiftLocations(Chunk.Begin, RowOffset);
+            Chunk.Diag.replay(Diag);
+
+            if (Chunk.Failed) {
+                Result.Failed = true;
+                return true;
+            }
+
+            if (&Chunk == &ChunkList.front()) {
+                Result = std::move(Chunk);
+            } else {
+                MergeChunk(Result, Chunk, RowOffset);
+            }
+
+            RowOffset += Chunk.RowCount;
+        }
+
+        if (RowOffset > SourceLocation::RowLimit) {
+            // A file of only blank lines and comments has no tokens.
+            Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location =
+                    !Result.TokenList.empty() ?
+                        Result.TokenList.back().Loc : SourceLocation(),
+                .Message = "Source file has too many lines"
+            });
+
+            Result.Failed = true;
+        }
+
+        return true;
+    }
+
+    auto
+    TokenBuffer::Create(const ADT::SourceBuffer &SrcBuffer,
+                        DiagnosticConsumer &Diag,
+                        const TokenBufferOptions Options) noexcept
+        -> std::optional<TokenBuffer>
+    {
+        auto Result = LexedChunk();
+        if (!Options.LexInParallel ||
+            !LexInParallel(SrcBuffer.text(), Diag, Result))
+        {
+            LexChunk(SrcBuffer.text(), Diag, Result);
+        }
+
+        if (Result.Failed) {
+            return std::nullopt;
+        }
+
+        return TokenBuffer(SrcBuffer, std::move(Result.LineInfoList),
+                           std::move(Result.TokenList),
+                           std::move(Result.NumberInfoList));
+    }
+
+    static auto
+    FindLineStart(const std::string_view Text, const uint32_t Index) noexcept
+        -> LineInfo
+    {
+        if (Index == 0) {
+            return LineInfo { .ByteOffset = 0 };
+        }
+
+        const auto Pos = Text.rfind('\n', Index - 1);
+        if (Pos == std::string_view::npos) {
+            return LineInfo { .ByteOffset = 0 };
+        }
+
+        return LineInfo { .ByteOffset = static_cast<uint32_t>(Pos + 1) };
+    }
+
+    auto
+    TokenBuffer::CreateByEditing(const TokenBuffer &Old,
+                                 const ADT::SourceBuffer &SrcBuffer,
+                                 const TextEdit Edit,
+                                 DiagnosticConsumer &Diag) noexcept
+        -> std::optional<std::pair<TokenBuffer, TokenEdit>>
+    {
+        const auto Text = SrcBuffer.text();
+        const auto OldTokenList = Old.getTokenList();
+        const auto OldTokenCount = static_cast<uint32_t>(OldTokenList.size());
+
+        const auto OldEditEnd = Edit.Offset + Edit.RemovedLength;
+        const auto NewEditEnd = Edit.Offset + Edit.InsertedLength;
+        const auto IndexDelta =
+            static_cast<int32_t>(
+                int64_t(Edit.InsertedLength) - int64_t(Edit.RemovedLength));
+
+        // Start relexing one token before the first token that touches the
+        // edit, as the tokenizer looks past the end of a token to decide
+        // where the token ends.
+
+        auto Begin =
+            static_cast<uint32_t>(
+                std::ranges::lower_bound(OldTokenList, Edit.Offset,
+                                         std::less(),
+                                         [](const Token &Token) noexcept {
+                                             return Token.End.Index;
+                                         }) - OldTokenList.begin());
+
+        if (Begin != 0) {
+            Begin--;
+        }
+
+        // An edit before the first token, such as in leading whitespace or
+        // comments, is relexed from the start of the buffer.
+
+        auto StartLoc = SourceLocation();
+        if (Begin != OldTokenCount &&
+            (Begin != 0 || Edit.Offset >= OldTokenList[0].Loc.Index))
+        {
+            StartLoc = OldTokenList[Begin].Loc;
+        }
+
+        const auto StartLineInfo = FindLineStart(Text, StartLoc.Index);
+
+        // Lex until a token after the inserted text lines up with an old
+        // token after the removed text. From there on the old tokens are still
+        // valid, and only have to be moved.
+
+        auto Tokenizer = Lex::Tokenizer(Text, Diag, StartLoc, StartLineInfo);
+        auto Chunk = LexedChunk();
+
+        // A line is recorded when a token ends on it, so keep the lines up to
+        // the end of the last token before the relexed ones.
+
+        auto LineInfoList = std::vector<LineInfo>();
+        if (Begin != 0) {
+            const auto PrefixEnd = OldTokenList[Begin - 1].End.Index;
+            for (const auto LineInfo : Old.LineInfoList) {
+                if (LineInfo.ByteOffset > PrefixEnd) {
+                    break;
+                }
+
+                LineInfoList.emplace_back(LineInfo);
+            }
+        }
+
+        auto Resync = OldTokenCount;
+        auto RowDelta = int32_t();
+
+        for (auto OldIndex = Begin;;) {
+            const auto [Token, LineInfo] = Tokenizer.next();
+            if (Token.isInvalid()) {
+                return std::nullopt;
+            }
+
+            if (Token.Loc.Index >= NewEditEnd && !Token.isEof()) {
+                const auto OldLocIndex = int64_t(Token.Loc.Index) - IndexDelta;
+                while (OldIndex != OldTokenCount &&
+                       OldTokenList[OldIndex].Loc.Index < OldLocIndex)
+                {
+                    OldIndex++;
+                }
+
+                if (OldIndex != OldTokenCount) {
+                    const auto &OldToken = OldTokenList[OldIndex];
+                    if (OldToken.Loc.Index == OldLocIndex &&
+                        OldToken.Loc.Index >= OldEditEnd &&
+                        OldToken.Kind == Token.Kind &&
+                        OldToken.Loc.Column == Token.Loc.Column)
+                    {
+                        Resync = OldIndex;
+                        RowDelta =
+                            static_cast<int32_t>(Token.Loc.Row) -
+                            static_cast<int32_t>(OldToken.Loc.Row);
+
+                        break;
+                    }
+                }
+            }
+
+            if (LineInfoList.empty() ||
+                LineInfoList.back().ByteOffset != LineInfo.ByteOffset)
+            {
+                LineInfoList.emplace_back(LineInfo);
+            }
+
+            if (Token.isEof()) {
+                break;
+            }
+
+            Chunk.TokenList.emplace_back(Token);
+            if (Token.Kind == TokenKind::IntegerLiteral ||
+                Token.Kind == TokenKind::FloatLiteral)
+            {
+                Chunk.NumberInfoList.emplace_back(NumberInfo {
+                    .Index = Token.Loc.Index,
+                    .Result = Lex::ParseNumber(Token.getString(Text))
+                });
+            }
+        }
+
+        const auto Shift =
+            SourceLocationShift { .Index = IndexDelta, .Row = RowDelta };
+
+        if (Resync != OldTokenCount &&
+            int64_t(OldTokenList.back().End.Row) + RowDelta >
+                SourceLocation::RowLimit)
+        {
+            Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = OldTokenList.back().End.shifted(Shift),
+                .Message = "Source file has too many lines"
+            });
+
+            return std::nullopt;
+        }
+
+        // Splice the relexed tokens between the unchanged tokens before the
+        // edit, and the moved tokens after it.
+
+        const auto SuffixList = OldTokenList.subspan(Resync);
+        const auto NewEnd =
+            Begin + static_cast<uint32_t>(Chunk.TokenList.size());
+
+        auto TokenList = std::vector<Token>();
+        TokenList.reserve(NewEnd + SuffixList.size());
+
+        TokenList.insert(TokenList.end(), OldTokenList.begin(),
+                         OldTokenList.begin() + Begin);
+        TokenList.insert(TokenList.end(), Chunk.TokenList.begin(),
+                         Chunk.TokenList.end());
+
+        for (auto Token : SuffixList) {
+            Token.Loc = Token.Loc.shifted(Shift);
+            Token.End = Token.End.shifted(Shift);
+
+            TokenList.emplace_back(Token);
+        }
+
+        const auto SuffixIndex =
+            SuffixList.empty() ? UINT32_MAX : SuffixList.front().Loc.Index;
+
+        // Number-literals are kept sorted by index, like the tokens.
+
+        auto NumberInfoList = std::vector<NumberInfo>();
+        for (const auto &NumberInfo : Old.NumberInfoList) {
+            if (NumberInfo.Index >= StartLoc.Index) {
+                break;
+            }
+
+            NumberInfoList.emplace_back(NumberInfo);
+        }
+
+        NumberInfoList.insert(NumberInfoList.end(),
+                              Chunk.NumberInfoList.begin(),
+                              Chunk.NumberInfoList.end());
+
+        for (auto NumberInfo : Old.NumberInfoList) {
+            if (NumberInfo.Index >= SuffixIndex) {
+                NumberInfo.Index += IndexDelta;
+                NumberInfoList.emplace_back(NumberInfo);
+            }
+        }
+
+        // The line that the first moved token ends on may have started
+        // inside the edit, so find its start in the new text. Later lines are
+        // only moved.
+
+        if (!SuffixList.empty()) {
+            const auto SuffixEnd = SuffixList.front().End;
+            const auto SuffixEndLine =
+                FindLineStart(Text, SuffixEnd.shifted(Shift).Index);
+
+            if (LineInfoList.empty() ||
+                LineInfoList.back().ByteOffset < SuffixEndLine.ByteOffset)
+            {
+                LineInfoList.emplace_back(SuffixEndLine);
+            }
+
+            const auto OldLineInfoList = Old.getLineInfoList();
+            const auto Iter =
+                std::ranges::upper_bound(OldLineInfoList, SuffixEnd.Index,
+                                         std::less(), &LineInfo::ByteOffset);
+
+            for (auto LineInfo : std::span(Iter, OldLineInfoList.end())) {
+                LineInfo.ByteOffset += IndexDelta;
+                LineInfoList.emplace_back(LineInfo);
+            }
+        }
+
+        return std::pair(
+            TokenBuffer(SrcBuffer, std::move(LineInfoList),
+                        std::move(TokenList), std::move(NumberInfoList)),
+            TokenEdit {
+                .Begin = Begin,
+                .OldEnd = Resync,
+                .NewEnd = NewEnd,
+                .Shift = Shift
+            });
+    }
+
+    auto TokenBuffer::getNumberForToken(const Token Token) const noexcept
+        -> const Lex::ParseNumberResult &
+    {
+        const auto Iter =
+            std::ranges::lower_bound(this->NumberInfoList, Token.Loc.Index,
+                                     std::less(), &NumberInfo::Index);
+
+        assert(Iter != this->NumberInfoList.end() &&
+               Iter->Index == Token.Loc.Index &&
+               "Token isn't a number-literal");
+
+        return Iter->Result;
     }
 }
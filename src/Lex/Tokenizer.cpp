@@ -12,10 +12,7 @@ namespace Lex {
         for (auto Char = this->consume();; Char = this->consume()) {
             if (Char == '\0') {
                 if (State == State::Identifier) {
-                    const auto TokenKindOpt =
-                        KeywordToLexemeMap.keyFor(Result.getString(Text));
-
-                    if (TokenKindOpt.has_value()) {
+                    if (KeywordForLexeme(Result.getString(Text)).has_value()) {
                         Result.Kind = TokenKind::Keyword;
                     }
 
@@ -46,6 +43,7 @@ namespace Lex {
                     // starting token.
 
                     Result.Loc.Index = this->Loc.Index - 1;
+                    Result.Loc.Row = this->Loc.Row;
                     Result.Loc.Column = this->Loc.Column - 1;
 
                     switch (Char) {
@@ -247,8 +245,46 @@ namespace Lex {
                         case 'X':
                             break;
                         case '.':
-                            Result.Kind = TokenKind::FloatLiteral;
+                            // Only a dot followed by a digit continues the
+                            // number, so `0..5` still lexes as a range.
+
+                            if (this->peek() >= '0' && this->peek() <= '9') {
+                                State = State::FloatLiteral;
+                                Result.Kind = TokenKind::FloatLiteral;
+
+                                break;
+                            }
+
+                            this->Loc.Index--;
+                            this->Loc.Column--;
+
+                            goto done;
+                        case '+':
+                        case '-': {
+                            // A signed exponent, as in `1e-3`, makes the
+                            // number a float. In a hex number, `e` is a digit,
+                            // so the sign is an operator after it instead.
+
+                            const auto Prev = this->Text[this->Loc.Index - 2];
+                            const auto IsHex =
+                                this->Text[Result.Loc.Index] == '0' &&
+                                (this->Text[Result.Loc.Index + 1] == 'x' ||
+                                 this->Text[Result.Loc.Index + 1] == 'X');
+
+                            if ((Prev == 'e' || Prev == 'E') && !IsHex &&
+                                this->peek() >= '0' && this->peek() <= '9')
+                            {
+                                State = State::FloatLiteral;
+                                Result.Kind = TokenKind::FloatLiteral;
+
+                                break;
+                            }
+
+                            this->Loc.Index--;
+                            this->Loc.Column--;
+
                             goto done;
+                        }
                         case 's':
                         case 'S':
                         case 'u':
@@ -279,7 +315,24 @@ namespace Lex {
                 case State::FloatLiteral:
                     switch (Char) {
                         case '0'...'9':
+                        case 'e':
+                        case 'E':
                             break;
+                        case '+':
+                        case '-': {
+                            // A sign is only part of the number when it
+                            // follows the exponent's `e`.
+
+                            const auto Prev = this->Text[this->Loc.Index - 2];
+                            if (Prev == 'e' || Prev == 'E') {
+                                break;
+                            }
+
+                            this->Loc.Index--;
+                            this->Loc.Column--;
+
+                            goto done;
+                        }
                         default:
                             this->Loc.Index--;
                             this->Loc.Column--;
@@ -607,10 +660,7 @@ namespace Lex {
         Result.End.Column = this->Loc.Column;
 
         if (Result.Kind == TokenKind::Identifier) {
-            const auto KeywordOpt =
-                KeywordToLexemeMap.keyFor(Result.getString(Text));
-
-            if (KeywordOpt.has_value()) {
+            if (KeywordForLexeme(Result.getString(Text)).has_value()) {
                 Result.Kind = TokenKind::Keyword;
             }
         }
@@ -0,0 +1,481 @@
+/*
+ * Misc/CompileServer.cpp
+ * © suhas pai
+ */
+
+#include <array>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <print>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Misc/CompileServer.h"
+
+namespace Interface {
+    // A request is a header carrying the client's stdin, stdout and stderr,
+    // followed by the client's working directory and arguments, each ending
+    // with a null character. The server answers with the exit code.
+
+    constexpr static auto ForwardedFdCount = 3;
+    constexpr static auto MaxRequestSize = uint32_t(1) << 20;
+
+    struct RequestHeader {
+        uint32_t Size;
+    };
+
+    union ControlMessage {
+        cmsghdr Header;
+        char Buffer[CMSG_SPACE(sizeof(int) * ForwardedFdCount)];
+    };
+
+    struct Request {
+        std::string WorkingDir;
+        std::vector<std::string> ArgList;
+        std::array<int, ForwardedFdCount> FdList;
+    };
+
+    static auto
+    SendAll(const int Fd, const void *const Data, const size_t Size) noexcept
+        -> bool
+    {
+        const auto Begin = static_cast<const char *>(Data);
+        for (auto Offset = size_t(); Offset != Size;) {
+            const auto Result =
+                send(Fd, Begin + Offset, Size - Offset, MSG_NOSIGNAL);
+
+            if (Result == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                return false;
+            }
+
+            Offset += static_cast<size_t>(Result);
+        }
+
+        return true;
+    }
+
+    static auto
+    ReceiveAll(const int Fd, void *const Data, const size_t Size) noexcept
+        -> bool
+    {
+        const auto Begin = static_cast<char *>(Data);
+        for (auto Offset = size_t(); Offset != Size;) {
+            const auto Result = recv(Fd, Begin + Offset, Size - Offset, 0);
+            if (Result == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                return false;
+            }
+
+            if (Result == 0) {
+                return false;
+            }
+
+            Offset += static_cast<size_t>(Result);
+        }
+
+        return true;
+    }
+
+    static auto CreateSocketAddress(const std::string_view SocketPath) noexcept
+        -> std::optional<sockaddr_un>
+    {
+        auto Address = sockaddr_un();
+        if (SocketPath.empty() || SocketPath.size() >= sizeof(Address.sun_path))
+        {
+            std::print(stderr,
+                       "Socket path must be between 1 and {} characters: {}\n",
+                       sizeof(Address.sun_path) - 1,
+                       SocketPath);
+            return std::nullopt;
+        }
+
+        Address.sun_family = AF_UNIX;
+        memcpy(Address.sun_path, SocketPath.data(), SocketPath.size());
+
+        return Address;
+    }
+
+    static auto ReceiveRequest(const int Fd) noexcept -> std::optional<Request>
+    {
+        auto Header = RequestHeader();
+        auto HeaderIov = iovec{
+            .iov_base = &Header,
+            .iov_len = sizeof(Header)
+        };
+
+        auto Control = ControlMessage();
+        auto Message = msghdr{
+            .msg_iov = &HeaderIov,
+            .msg_iovlen = 1,
+            .msg_control = &Control,
+            .msg_controllen = sizeof(Control),
+        };
+
+        auto Result = ssize_t();
+        do {
+            Result = recvmsg(Fd, &Message, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+        } while (Result == -1 && errno == EINTR);
+
+        const auto ControlMsg = CMSG_FIRSTHDR(&Message);
+        if (ControlMsg == nullptr ||
+            ControlMsg->cmsg_level != SOL_SOCKET ||
+            ControlMsg->cmsg_type != SCM_RIGHTS ||
+            ControlMsg->cmsg_len != CMSG_LEN(sizeof(int) * ForwardedFdCount))
+        {
+            return std::nullopt;
+        }
+
+        auto Request = Interface::Request();
+        memcpy(Request.FdList.data(),
+               CMSG_DATA(ControlMsg),
+               sizeof(int) * ForwardedFdCount);
+
+        const auto CloseFdList = [&]() noexcept {
+            for (const auto ReceivedFd : Request.FdList) {
+                close(ReceivedFd);
+            }
+        };
+
+        if (Result != sizeof(Header) || Header.Size > MaxRequestSize) {
+            CloseFdList();
+            return std::nullopt;
+        }
+
+        auto Payload = std::string(Header.Size, '\0');
+        if (!ReceiveAll(Fd, Payload.data(), Payload.size()) ||
+            !Payload.ends_with('\0'))
+        {
+            CloseFdList();
+            return std::nullopt;
+        }
+
+        auto Rest = std::string_view(Payload);
+        auto Position = Rest.find('\0');
+
+        Request.WorkingDir = Rest.substr(0, Position);
+        Rest.remove_prefix(Position + 1);
+
+        while (!Rest.empty()) {
+            Position = Rest.find('\0');
+
+            Request.ArgList.emplace_back(Rest.substr(0, Position));
+            Rest.remove_prefix(Position + 1);
+        }
+
+        return Request;
+    }
+
+    [[noreturn]] static void
+    RunRequest(const int ConnectionFd,
+               const Request &Request,
+               const CompileRequestHandler &Handler) noexcept
+    {
+        for (auto I = 0; I != ForwardedFdCount; I++) {
+            const auto Fd = Request.FdList[static_cast<size_t>(I)];
+
+            dup2(Fd, I);
+            if (Fd >= ForwardedFdCount) {
+                close(Fd);
+            }
+        }
+
+        close(ConnectionFd);
+        if (chdir(Request.WorkingDir.c_str()) != 0) {
+            std::print(stderr,
+                       "Failed to change directory to {}, reason: {}\n",
+                       Request.WorkingDir,
+                       strerror(errno));
+            exit(1);
+        }
+
+        auto Argv = std::vector<const char *>();
+        for (const auto &Arg : Request.ArgList) {
+            Argv.push_back(Arg.c_str());
+        }
+
+        Argv.push_back(nullptr);
+        exit(Handler(static_cast<int>(Request.ArgList.size()), Argv.data()));
+    }
+
+    // Runs in a process forked for the connection, which waits on another
+    // forked process to run the request. This way the exit code still gets
+    // to the client when the request calls exit() or crashes.
+
+    [[noreturn]] static void
+    ServeConnection(const int ListenFd,
+                    const int ConnectionFd,
+                    const CompileRequestHandler &Handler) noexcept
+    {
+        close(ListenFd);
+        signal(SIGCHLD, SIG_DFL);
+
+        const auto RequestOpt = ReceiveRequest(ConnectionFd);
+        if (!RequestOpt.has_value()) {
+            _exit(1);
+        }
+
+        const auto &Request = RequestOpt.value();
+        const auto Pid = fork();
+
+        if (Pid == 0) {
+            RunRequest(ConnectionFd, Request, Handler);
+        }
+
+        for (const auto ReceivedFd : Request.FdList) {
+            close(ReceivedFd);
+        }
+
+        auto ExitCode = int32_t(1);
+        if (Pid != -1) {
+            auto Status = 0;
+            while (waitpid(Pid, &Status, 0) == -1 && errno == EINTR) {}
+
+            if (WIFEXITED(Status)) {
+                ExitCode = WEXITSTATUS(Status);
+            } else if (WIFSIGNALED(Status)) {
+                ExitCode = 128 + WTERMSIG(Status);
+            }
+        }
+
+        SendAll(ConnectionFd, &ExitCode, sizeof(ExitCode));
+        _exit(0);
+    }
+
+    // Removes the socket at Address if it was left behind by a server that
+    // is no longer running. Returns false if something else is at the path,
+    // including the socket of a server that is still running.
+
+    static auto
+    RemoveStaleSocket(const sockaddr_un &Address,
+                      const std::string_view SocketPath) noexcept -> bool
+    {
+        struct stat Stat;
+        if (lstat(Address.sun_path, &Stat) != 0) {
+            if (errno == ENOENT) {
+                return true;
+            }
+
+            std::print(stderr,
+                       "Failed to check {}, reason: {}\n",
+                       SocketPath,
+                       strerror(errno));
+            return false;
+        }
+
+        if (!S_ISSOCK(Stat.st_mode)) {
+            std::print(stderr,
+                       "{} already exists and isn't a socket\n",
+                       SocketPath);
+            return false;
+        }
+
+        const auto ProbeFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (ProbeFd == -1) {
+            std::print(stderr,
+                       "Failed to create socket, reason: {}\n",
+                       strerror(errno));
+            return false;
+        }
+
+        const auto Connected =
+            connect(ProbeFd,
+                    reinterpret_cast<const sockaddr *>(&Address),
+                    sizeof(Address)) == 0;
+        const auto ConnectErrno = errno;
+
+        close(ProbeFd);
+        if (Connected) {
+            std::print(stderr,
+                       "A server is already running on {}\n",
+                       SocketPath);
+            return false;
+        }
+
+        // Only a socket nothing is listening on is refused.
+        if (ConnectErrno != ECONNREFUSED) {
+            std::print(stderr,
+                       "Failed to check {}, reason: {}\n",
+                       SocketPath,
+                       strerror(ConnectErrno));
+            return false;
+        }
+
+        unlink(Address.sun_path);
+        return true;
+    }
+
+    auto
+    RunCompileServer(const std::string_view SocketPath,
+                     const CompileRequestHandler &Handler) noexcept -> int
+    {
+        const auto AddressOpt = CreateSocketAddress(SocketPath);
+        if (!AddressOpt.has_value()) {
+            return 1;
+        }
+
+        const auto ListenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (ListenFd == -1) {
+            std::print(stderr,
+                       "Failed to create socket, reason: {}\n",
+                       strerror(errno));
+            return 1;
+        }
+
+        const auto &Address = AddressOpt.value();
+        if (!RemoveStaleSocket(Address, SocketPath)) {
+            close(ListenFd);
+            return 1;
+        }
+
+        if (bind(ListenFd,
+                 reinterpret_cast<const sockaddr *>(&Address),
+                 sizeof(Address)) != 0 ||
+            listen(ListenFd, SOMAXCONN) != 0)
+        {
+            std::print(stderr,
+                       "Failed to listen on {}, reason: {}\n",
+                       SocketPath,
+                       strerror(errno));
+
+            close(ListenFd);
+            return 1;
+        }
+
+        // Let the processes forked for each connection be reaped
+        // automatically.
+        signal(SIGCHLD, SIG_IGN);
+
+        while (true) {
+            const auto ConnectionFd =
+                accept4(ListenFd, nullptr, nullptr, SOCK_CLOEXEC);
+
+            if (ConnectionFd == -1) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+
+                std::print(stderr,
+                           "Failed to accept connection, reason: {}\n",
+                           strerror(errno));
+
+                close(ListenFd);
+                return 1;
+            }
+
+            // Don't let output buffered by the server be written twice.
+            fflush(nullptr);
+
+            if (fork() == 0) {
+                ServeConnection(ListenFd, ConnectionFd, Handler);
+            }
+
+            close(ConnectionFd);
+        }
+    }
+
+    auto
+    RunCompileClient(const std::string_view SocketPath,
+                     const int Argc,
+                     const char *const Argv[]) noexcept -> int
+    {
+        const auto AddressOpt = CreateSocketAddress(SocketPath);
+        if (!AddressOpt.has_value()) {
+            return 1;
+        }
+
+        const auto WorkingDir = getcwd(nullptr, 0);
+        if (WorkingDir == nullptr) {
+            std::print(stderr,
+                       "Failed to get working directory, reason: {}\n",
+                       strerror(errno));
+            return 1;
+        }
+
+        auto Payload = std::string(WorkingDir);
+        free(WorkingDir);
+
+        Payload.push_back('\0');
+        for (auto I = 0; I != Argc; I++) {
+            Payload.append(Argv[I]);
+            Payload.push_back('\0');
+        }
+
+        if (Payload.size() > MaxRequestSize) {
+            std::print(stderr, "Arguments are too long to send to server\n");
+            return 1;
+        }
+
+        const auto Fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        const auto &Address = AddressOpt.value();
+
+        if (Fd == -1 ||
+            connect(Fd,
+                    reinterpret_cast<const sockaddr *>(&Address),
+                    sizeof(Address)) != 0)
+        {
+            std::print(stderr,
+                       "Failed to connect to server at {}, reason: {}\n",
+                       SocketPath,
+                       strerror(errno));
+
+            if (Fd != -1) {
+                close(Fd);
+            }
+
+            return 1;
+        }
+
+        auto Header = RequestHeader{ .Size = uint32_t(Payload.size()) };
+        auto HeaderIov = iovec{
+            .iov_base = &Header,
+            .iov_len = sizeof(Header)
+        };
+
+        auto Control = ControlMessage();
+        auto Message = msghdr{
+            .msg_iov = &HeaderIov,
+            .msg_iovlen = 1,
+            .msg_control = &Control,
+            .msg_controllen = sizeof(Control),
+        };
+
+        const auto ControlMsg = CMSG_FIRSTHDR(&Message);
+        const int FdList[ForwardedFdCount] = {
+            STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO
+        };
+
+        ControlMsg->cmsg_level = SOL_SOCKET;
+        ControlMsg->cmsg_type = SCM_RIGHTS;
+        ControlMsg->cmsg_len = CMSG_LEN(sizeof(FdList));
+
+        memcpy(CMSG_DATA(ControlMsg), FdList, sizeof(FdList));
+
+        auto ExitCode = int32_t(1);
+        if (sendmsg(Fd, &Message, MSG_NOSIGNAL) != sizeof(Header) ||
+            !SendAll(Fd, Payload.data(), Payload.size()) ||
+            !ReceiveAll(Fd, &ExitCode, sizeof(ExitCode)))
+        {
+            std::print(stderr, "Server at {} failed the request\n", SocketPath);
+            ExitCode = 1;
+        }
+
+        close(Fd);
+        return ExitCode;
+    }
+}
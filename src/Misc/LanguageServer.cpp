@@ -0,0 +1,1195 @@
+/*
+ * Misc/LanguageServer.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <format>
+#include <memory>
+#include <print>
+#include <unordered_map>
+
+#include "llvm/Support/Casting.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "AST/Decls/ArrayBindingVarDecl.h"
+#include "AST/Decls/EnumDecl.h"
+#include "AST/Decls/EnumMemberDecl.h"
+#include "AST/Decls/InterfaceDecl.h"
+#include "AST/Decls/ObjectBindingVarDecl.h"
+#include "AST/Decls/ShapeDecl.h"
+#include "AST/Decls/StructDecl.h"
+#include "AST/Decls/UnionDecl.h"
+#include "AST/Decls/VarDecl.h"
+
+#include "Diag/Consumer.h"
+#include "Lex/TokenBuffer.h"
+#include "Misc/LanguageServer.h"
+#include "Parse/ParseUnit.h"
+#include "Sema/ResolveNames.h"
+
+namespace Interface {
+    struct StmtDiagInfo {
+        // Location of the statement when the messages were collected, to
+        // move the messages along with the statement.
+        SourceLocation Loc;
+        std::vector<DiagnosticMessage> MessageList;
+
+        // Messages from Sema, kept until the statement is resolved again.
+        std::vector<DiagnosticMessage> SemaMessageList;
+    };
+
+    // A document the client has open. Every edit creates a new source-buffer,
+    // as tokens and AST nodes that are kept across edits may still point into
+    // the text of the buffer they were created from.
+
+    struct Document {
+        std::string Text;
+        std::vector<uint32_t> LineStartList;
+
+        // The buffer of the current text is last. The older ones are kept
+        // until the document is parsed in full again, as statements reused
+        // since then may point into any of them.
+        std::vector<std::unique_ptr<ADT::SourceBuffer>> SrcBufferList;
+
+        std::optional<Lex::TokenBuffer> TokenBuffer;
+        std::optional<Parse::ParseUnit> Unit;
+
+        [[nodiscard]] auto &getSrcBuffer() const noexcept {
+            return *this->SrcBufferList.back();
+        }
+
+        // Messages inside a top-level statement are kept for as long as the
+        // statement is reused, as it isn't parsed again.
+        std::unordered_map<const AST::Stmt *, StmtDiagInfo> StmtDiagMap;
+        std::vector<DiagnosticMessage> OtherDiagList;
+
+        // Lets an edit resolve only the statements it could have changed.
+        Sema::DependencyGraph Graph;
+    };
+
+    enum class SymbolKind : uint8_t {
+        Field = 8,
+        Enum = 10,
+        Interface = 11,
+        Function = 12,
+        Variable = 13,
+        EnumMember = 22,
+        Struct = 23,
+    };
+
+    enum class ErrorCode : int32_t {
+        MethodNotFound = -32601,
+    };
+
+    static auto ReadMessage(std::string &Body) noexcept -> bool {
+        constexpr auto ContentLengthHeader =
+            std::string_view("Content-Length:");
+
+        auto ContentLength = std::optional<size_t>();
+        auto Line = std::string();
+
+        while (true) {
+            Line.clear();
+            for (auto Char = std::fgetc(stdin); Char != '\n';
+                 Char = std::fgetc(stdin))
+            {
+                if (Char == EOF) {
+                    return false;
+                }
+
+                Line.push_back(static_cast<char>(Char));
+            }
+
+            if (Line.ends_with('\r')) {
+                Line.pop_back();
+            }
+
+            // An empty line ends the header.
+            if (Line.empty()) {
+                break;
+            }
+
+            if (!Line.starts_with(ContentLengthHeader)) {
+                continue;
+            }
+
+            auto Value =
+                std::string_view(Line).substr(ContentLengthHeader.size());
+
+            while (Value.starts_with(' ')) {
+                Value.remove_prefix(1);
+            }
+
+            auto Length = size_t();
+            const auto Result =
+                std::from_chars(Value.data(), Value.data() + Value.size(),
+                                Length);
+
+            if (Result.ec == std::errc()) {
+                ContentLength = Length;
+            }
+        }
+
+        if (!ContentLength.has_value()) {
+            return false;
+        }
+
+        Body.resize(ContentLength.value());
+        return std::fread(Body.data(), 1, Body.size(), stdin) == Body.size();
+    }
+
+    static void SendMessage(llvm::json::Value &&Message) noexcept {
+        auto Body = std::string();
+        auto Stream = llvm::raw_string_ostream(Body);
+
+        Stream << Message;
+        Stream.flush();
+
+        std::print("Content-Length: {}\r\n\r\n{}", Body.size(), Body);
+        std::fflush(stdout);
+    }
+
+    static void
+    SendResult(const llvm::json::Value &Id,
+               llvm::json::Value &&Result) noexcept
+    {
+        SendMessage(llvm::json::Object {
+            { "jsonrpc", "2.0" },
+            { "id", Id },
+            { "result", std::move(Result) }
+        });
+    }
+
+    static void
+    SendError(const llvm::json::Value &Id,
+              const ErrorCode Code,
+              const std::string_view Message) noexcept
+    {
+        SendMessage(llvm::json::Object {
+            { "jsonrpc", "2.0" },
+            { "id", Id },
+            {
+                "error",
+                llvm::json::Object {
+                    { "code", static_cast<int32_t>(Code) },
+                    { "message", std::string(Message) }
+                }
+            }
+        });
+    }
+
+    // Positions in the protocol count UTF-16 code units, while locations in
+    // the compiler count bytes of UTF-8.
+
+    [[nodiscard]]
+    static auto GetUTF8SequenceLength(const char Char) noexcept -> uint32_t {
+        const auto Byte = static_cast<uint8_t>(Char);
+        if (Byte >= 0xF0) {
+            return 4;
+        }
+
+        if (Byte >= 0xE0) {
+            return 3;
+        }
+
+        if (Byte >= 0xC0) {
+            return 2;
+        }
+
+        return 1;
+    }
+
+    [[nodiscard]] static auto
+    GetLineText(const Document &Doc, const uint32_t Line) noexcept
+        -> std::string_view
+    {
+        const auto Begin = Doc.LineStartList[Line];
+        const auto End =
+            Line + 1 != Doc.LineStartList.size() ?
+                Doc.LineStartList[Line + 1] - 1 :
+                static_cast<uint32_t>(Doc.Text.size());
+
+        return std::string_view(Doc.Text).substr(Begin, End - Begin);
+    }
+
+    [[nodiscard]] static auto
+    GetInteger(const llvm::json::Object &Object,
+               const llvm::StringRef Key) noexcept -> int64_t
+    {
+        if (const auto Value = Object.getInteger(Key)) {
+            return *Value;
+        }
+
+        return 0;
+    }
+
+    [[nodiscard]] static auto
+    GetOffsetForPosition(const Document &Doc,
+                         const llvm::json::Object &Position) noexcept
+        -> uint32_t
+    {
+        const auto LineCount = static_cast<int64_t>(Doc.LineStartList.size());
+        const auto Line =
+            std::clamp(GetInteger(Position, "line"), int64_t(), LineCount - 1);
+
+        const auto Character = GetInteger(Position, "character");
+
+        const auto LineText = GetLineText(Doc, static_cast<uint32_t>(Line));
+
+        auto Units = int64_t();
+        auto Index = uint32_t();
+
+        while (Index < LineText.size() && Units < Character) {
+            const auto Length = GetUTF8SequenceLength(LineText[Index]);
+
+            Units += Length == 4 ? 2 : 1;
+            Index += Length;
+        }
+
+        return Doc.LineStartList[Line] +
+               std::min(Index, static_cast<uint32_t>(LineText.size()));
+    }
+
+    [[nodiscard]] static auto
+    GetPositionForOffset(const Document &Doc, const uint32_t Offset) noexcept
+        -> llvm::json::Object
+    {
+        const auto Iter =
+            std::ranges::upper_bound(Doc.LineStartList, Offset) - 1;
+
+        const auto Line =
+            static_cast<int64_t>(Iter - Doc.LineStartList.begin());
+
+        const auto Text =
+            std::string_view(Doc.Text).substr(*Iter, Offset - *Iter);
+
+        auto Units = int64_t();
+        for (auto Index = size_t(); Index < Text.size();) {
+            const auto Length = GetUTF8SequenceLength(Text[Index]);
+
+            Units += Length == 4 ? 2 : 1;
+            Index += Length;
+        }
+
+        return llvm::json::Object {
+            { "line", Line },
+            { "character", Units }
+        };
+    }
+
+    [[nodiscard]] static auto
+    GetRange(const Document &Doc,
+             const uint32_t Begin,
+             const uint32_t End) noexcept -> llvm::json::Object
+    {
+        return llvm::json::Object {
+            { "start", GetPositionForOffset(Doc, Begin) },
+            { "end", GetPositionForOffset(Doc, End) }
+        };
+    }
+
+    [[nodiscard]] static auto
+    GetNameRange(const Document &Doc,
+                 const AST::LvalueNamedDecl &Decl) noexcept
+        -> llvm::json::Object
+    {
+        const auto Begin = Decl.getNameLoc().Index;
+        return GetRange(Doc, Begin,
+                        Begin + static_cast<uint32_t>(Decl.getName().size()));
+    }
+
+    // Returns the token that contains Offset, or the token that starts right
+    // at Offset.
+
+    [[nodiscard]] static auto
+    FindTokenAtOffset(const Document &Doc, const uint32_t Offset) noexcept
+        -> std::optional<Lex::Token>
+    {
+        if (!Doc.TokenBuffer.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto TokenList = Doc.TokenBuffer->getTokenList();
+        const auto Iter =
+            std::ranges::upper_bound(TokenList, Offset, std::less(),
+                                     [](const Lex::Token &Token) noexcept {
+                                         return Token.Loc.Index;
+                                     });
+
+        if (Iter == TokenList.begin()) {
+            return std::nullopt;
+        }
+
+        const auto Token = *(Iter - 1);
+        if (Offset > Token.End.Index) {
+            return std::nullopt;
+        }
+
+        return Token;
+    }
+
+    // Returns the bytes [Begin, End) that the top-level statement at Index
+    // was parsed from.
+
+    [[nodiscard]] static auto
+    GetStmtByteRange(const Document &Doc, const size_t Index) noexcept
+        -> std::pair<uint32_t, uint32_t>
+    {
+        const auto TokenList = Doc.TokenBuffer->getTokenList();
+        const auto Range = Doc.Unit->getTopLevelStmtRangeList()[Index];
+
+        return std::pair(TokenList[Range.Begin].Loc.Index,
+                         TokenList[Range.End - 1].End.Index);
+    }
+
+    [[nodiscard]] static auto
+    FindTopLevelStmtIndex(const Document &Doc, const uint32_t Offset) noexcept
+        -> std::optional<size_t>
+    {
+        const auto RangeList = Doc.Unit->getTopLevelStmtRangeList();
+        const auto TokenList = Doc.TokenBuffer->getTokenList();
+
+        const auto Iter =
+            std::ranges::upper_bound(
+                RangeList, Offset, std::less(),
+                [TokenList](const Parse::ParseUnit::TokenRange Range) noexcept {
+                    return TokenList[Range.Begin].Loc.Index;
+                });
+
+        if (Iter == RangeList.begin()) {
+            return std::nullopt;
+        }
+
+        const auto Index = static_cast<size_t>(Iter - RangeList.begin()) - 1;
+        if (Offset > GetStmtByteRange(Doc, Index).second) {
+            return std::nullopt;
+        }
+
+        return Index;
+    }
+
+    [[nodiscard]] static auto
+    FindBindingNameLoc(std::span<AST::ObjectBindingField *const> FieldList,
+                       std::string_view Name) noexcept
+        -> std::optional<SourceLocation>;
+
+    // Returns the location of Name in the list of a binding declaration that
+    // declares it.
+
+    [[nodiscard]] static auto
+    FindBindingNameLoc(const std::span<AST::ArrayBindingItem *const> ItemList,
+                       const std::string_view Name) noexcept
+        -> std::optional<SourceLocation>
+    {
+        for (const auto Item : ItemList) {
+            auto Result = std::optional<SourceLocation>();
+            switch (Item->getKind()) {
+                case AST::ArrayBindingItemKind::Identifier: {
+                    const auto Identifier =
+                        llvm::cast<AST::ArrayBindingItemIdentifier>(Item);
+
+                    if (Identifier->getName() == Name) {
+                        Result = Identifier->getNameLoc();
+                    }
+
+                    break;
+                }
+                case AST::ArrayBindingItemKind::Array:
+                    Result =
+                        FindBindingNameLoc(
+                            llvm::cast<AST::ArrayBindingItemArray>(Item)
+                                ->getItemList(),
+                            Name);
+                    break;
+                case AST::ArrayBindingItemKind::Object:
+                    Result =
+                        FindBindingNameLoc(
+                            llvm::cast<AST::ArrayBindingItemObject>(Item)
+                                ->getFieldList(),
+                            Name);
+                    break;
+                case AST::ArrayBindingItemKind::Spread: {
+                    const auto Spread =
+                        llvm::cast<AST::ArrayBindingItemSpread>(Item);
+
+                    if (Spread->getName() == Name) {
+                        Result = Spread->getNameLoc();
+                    }
+
+                    break;
+                }
+            }
+
+            if (Result.has_value()) {
+                return Result;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] static auto
+    FindBindingNameLoc(
+        const std::span<AST::ObjectBindingField *const> FieldList,
+        const std::string_view Name) noexcept
+            -> std::optional<SourceLocation>
+    {
+        for (const auto Field : FieldList) {
+            auto Result = std::optional<SourceLocation>();
+            switch (Field->getKind()) {
+                case AST::ObjectBindingFieldKind::Identifier: {
+                    const auto Identifier =
+                        llvm::cast<AST::ObjectBindingFieldIdentifier>(Field);
+
+                    if (Identifier->getName() == Name) {
+                        Result = Identifier->getNameLoc();
+                    }
+
+                    break;
+                }
+                case AST::ObjectBindingFieldKind::Array:
+                    Result =
+                        FindBindingNameLoc(
+                            llvm::cast<AST::ObjectBindingFieldArray>(Field)
+                                ->getItemList(),
+                            Name);
+                    break;
+                case AST::ObjectBindingFieldKind::Object:
+                    Result =
+                        FindBindingNameLoc(
+                            llvm::cast<AST::ObjectBindingFieldObject>(Field)
+                                ->getFieldList(),
+                            Name);
+                    break;
+                case AST::ObjectBindingFieldKind::Spread:
+                    if (Field->getKey() == Name) {
+                        Result = Field->getKeyLoc();
+                    }
+
+                    break;
+            }
+
+            if (Result.has_value()) {
+                return Result;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    // Returns the bytes [Begin, End) of the name that the reference at Offset
+    // refers to. References are looked up in what Sema recorded for the
+    // top-level statement they're in, so they resolve to the same declaration
+    // they do when compiling.
+
+    [[nodiscard]] static auto
+    FindDefinition(const Document &Doc, const uint32_t Offset) noexcept
+        -> std::optional<std::pair<uint32_t, uint32_t>>
+    {
+        if (!Doc.Unit.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto TokenOpt = FindTokenAtOffset(Doc, Offset);
+        if (!TokenOpt.has_value() ||
+            TokenOpt->Kind != Lex::TokenKind::Identifier)
+        {
+            return std::nullopt;
+        }
+
+        const auto Index = FindTopLevelStmtIndex(Doc, Offset);
+        if (!Index.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto Node =
+            Doc.Graph.getNode(*Doc.Unit->getTopLevelStmtList()[Index.value()]);
+
+        if (Node == nullptr) {
+            return std::nullopt;
+        }
+
+        const auto Iter =
+            std::ranges::find_if(Node->DeclRefList,
+                                 [&](const AST::DeclRefExpr *const Ref) {
+                                     return Ref->getNameLoc().Index ==
+                                            TokenOpt->Loc.Index;
+                                 });
+
+        if (Iter == Node->DeclRefList.end()) {
+            return std::nullopt;
+        }
+
+        const auto Name = (*Iter)->getName();
+        const auto Decl = (*Iter)->getDecl();
+
+        auto NameLoc = std::optional<SourceLocation>();
+        if (const auto NamedDecl =
+                llvm::dyn_cast_if_present<AST::LvalueNamedDecl>(Decl))
+        {
+            NameLoc = NamedDecl->getNameLoc();
+        } else if (const auto ArrayDecl =
+                       llvm::dyn_cast_if_present<AST::ArrayBindingVarDecl>(
+                           Decl))
+        {
+            NameLoc = FindBindingNameLoc(ArrayDecl->getItemList(), Name);
+        } else if (const auto ObjectDecl =
+                       llvm::dyn_cast_if_present<AST::ObjectBindingVarDecl>(
+                           Decl))
+        {
+            NameLoc = FindBindingNameLoc(ObjectDecl->getFieldList(), Name);
+        }
+
+        if (!NameLoc.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto Begin = NameLoc->Index;
+        return std::pair(Begin, Begin + static_cast<uint32_t>(Name.size()));
+    }
+
+    [[nodiscard]]
+    static auto GetSymbolKind(const AST::LvalueNamedDecl &Decl) noexcept
+        -> SymbolKind
+    {
+        switch (Decl.getKind()) {
+            case AST::NodeKind::FieldDecl:
+            case AST::NodeKind::OptionalFieldDecl:
+                return SymbolKind::Field;
+            case AST::NodeKind::EnumMemberDecl:
+                return SymbolKind::EnumMember;
+            default:
+                break;
+        }
+
+        const auto Rvalue = Decl.getRvalueExpr();
+        if (Rvalue == nullptr) {
+            return SymbolKind::Variable;
+        }
+
+        switch (Rvalue->getKind()) {
+            case AST::NodeKind::ClosureDecl:
+            case AST::NodeKind::FunctionDecl:
+                return SymbolKind::Function;
+            case AST::NodeKind::EnumDecl:
+                return SymbolKind::Enum;
+            case AST::NodeKind::InterfaceDecl:
+            case AST::NodeKind::ShapeDecl:
+                return SymbolKind::Interface;
+            case AST::NodeKind::StructDecl:
+            case AST::NodeKind::UnionDecl:
+                return SymbolKind::Struct;
+            default:
+                return SymbolKind::Variable;
+        }
+    }
+
+    [[nodiscard]]
+    static auto GetMemberList(const AST::Expr *const Expr) noexcept
+        -> std::span<AST::Stmt *const>
+    {
+        if (Expr == nullptr) {
+            return {};
+        }
+
+        switch (Expr->getKind()) {
+            case AST::NodeKind::EnumDecl:
+                return llvm::cast<AST::EnumDecl>(Expr)->getMemberList();
+            case AST::NodeKind::InterfaceDecl:
+                return llvm::cast<AST::InterfaceDecl>(Expr)->getFieldList();
+            case AST::NodeKind::ShapeDecl:
+                return llvm::cast<AST::ShapeDecl>(Expr)->getFieldList();
+            case AST::NodeKind::StructDecl:
+                return llvm::cast<AST::StructDecl>(Expr)->getFieldList();
+            case AST::NodeKind::UnionDecl:
+                return llvm::cast<AST::UnionDecl>(Expr)->getFieldList();
+            default:
+                return {};
+        }
+    }
+
+    [[nodiscard]] static auto
+    GetDocumentSymbol(const Document &Doc,
+                      const AST::LvalueNamedDecl &Decl,
+                      llvm::json::Object &&Range) noexcept
+        -> llvm::json::Object
+    {
+        auto ChildList = llvm::json::Array();
+        for (const auto Member : GetMemberList(Decl.getRvalueExpr())) {
+            if (const auto MemberDecl =
+                    llvm::dyn_cast<AST::LvalueNamedDecl>(Member))
+            {
+                ChildList.emplace_back(
+                    GetDocumentSymbol(Doc, *MemberDecl,
+                                      GetNameRange(Doc, *MemberDecl)));
+            }
+        }
+
+        return llvm::json::Object {
+            { "name", std::string(Decl.getName()) },
+            { "kind", static_cast<int32_t>(GetSymbolKind(Decl)) },
+            { "range", std::move(Range) },
+            { "selectionRange", GetNameRange(Doc, Decl) },
+            { "children", std::move(ChildList) }
+        };
+    }
+
+    [[nodiscard]]
+    static auto GetDocumentSymbolList(const Document &Doc) noexcept
+        -> llvm::json::Array
+    {
+        auto Result = llvm::json::Array();
+        if (!Doc.Unit.has_value()) {
+            return Result;
+        }
+
+        const auto StmtList = Doc.Unit->getTopLevelStmtList();
+        for (auto I = size_t(); I != StmtList.size(); I++) {
+            const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(StmtList[I]);
+            if (Decl == nullptr) {
+                continue;
+            }
+
+            const auto [Begin, End] = GetStmtByteRange(Doc, I);
+            Result.emplace_back(
+                GetDocumentSymbol(Doc, *Decl, GetRange(Doc, Begin, End)));
+        }
+
+        return Result;
+    }
+
+    // Files messages under the top-level statement they're inside of. Messages
+    // of statements that were reused from the previous unit are kept.
+
+    static void
+    UpdateDiagnostics(Document &Doc,
+                      const std::span<const DiagnosticMessage> NewList) noexcept
+    {
+        auto OldMap = std::move(Doc.StmtDiagMap);
+
+        Doc.StmtDiagMap.clear();
+        Doc.OtherDiagList.clear();
+
+        if (!Doc.Unit.has_value()) {
+            Doc.OtherDiagList.assign(NewList.begin(), NewList.end());
+            return;
+        }
+
+        const auto StmtList = Doc.Unit->getTopLevelStmtList();
+        auto PrevWasReused = true;
+
+        for (auto I = size_t(); I != StmtList.size(); I++) {
+            const auto Stmt = StmtList[I];
+            auto &Info = Doc.StmtDiagMap[Stmt];
+
+            Info.Loc = Stmt->getLoc();
+
+            const auto Iter = OldMap.find(Stmt);
+            const auto FollowsParsedStmt = !PrevWasReused;
+
+            PrevWasReused = Iter != OldMap.end();
+            if (!PrevWasReused) {
+                continue;
+            }
+
+            // A statement missing its ending semicolon reports it at the
+            // first token of the next statement. If the statement before was
+            // parsed again, it reported any such message again.
+
+            const auto StmtBegin = GetStmtByteRange(Doc, I).first;
+
+            const auto Shift = SourceLocationShift {
+                .Index =
+                    static_cast<int32_t>(Info.Loc.Index) -
+                    static_cast<int32_t>(Iter->second.Loc.Index),
+                .Row =
+                    static_cast<int32_t>(Info.Loc.Row) -
+                    static_cast<int32_t>(Iter->second.Loc.Row)
+            };
+
+            for (auto &Message : Iter->second.MessageList) {
+                // Reused statements are added to the new unit again, which
+                // reports reused decl names again if they still are. Every
+                // other message of a reused statement came from parsing it,
+                // and still applies.
+
+                if (Message.IsReusedDeclName) {
+                    continue;
+                }
+
+                Message.Location = Message.Location.shifted(Shift);
+                if (FollowsParsedStmt &&
+                    Message.Location.Index <= StmtBegin)
+                {
+                    continue;
+                }
+
+                Info.MessageList.emplace_back(std::move(Message));
+            }
+
+            for (auto &Message : Iter->second.SemaMessageList) {
+                Message.Location = Message.Location.shifted(Shift);
+                Info.SemaMessageList.emplace_back(std::move(Message));
+            }
+        }
+
+        for (const auto &Message : NewList) {
+            const auto Index =
+                FindTopLevelStmtIndex(Doc, Message.Location.Index);
+
+            if (!Index.has_value()) {
+                Doc.OtherDiagList.emplace_back(Message);
+                continue;
+            }
+
+            Doc.StmtDiagMap[StmtList[Index.value()]].MessageList.emplace_back(
+                Message);
+        }
+    }
+
+    // Replaces the Sema messages of every statement in ResolvedList with the
+    // ones in NewList.
+
+    static void
+    UpdateSemaDiagnostics(
+        Document &Doc,
+        const std::span<AST::Stmt *const> ResolvedList,
+        const std::span<const DiagnosticMessage> NewList) noexcept
+    {
+        for (const auto Stmt : ResolvedList) {
+            Doc.StmtDiagMap[Stmt].SemaMessageList.clear();
+        }
+
+        const auto StmtList = Doc.Unit->getTopLevelStmtList();
+        for (const auto &Message : NewList) {
+            const auto Index =
+                FindTopLevelStmtIndex(Doc, Message.Location.Index);
+
+            if (!Index.has_value()) {
+                Doc.OtherDiagList.emplace_back(Message);
+                continue;
+            }
+
+            Doc.StmtDiagMap[StmtList[Index.value()]].SemaMessageList
+                .emplace_back(Message);
+        }
+    }
+
+    constexpr static auto MaxEditBufferCount = size_t(64);
+
+    static void Analyze(Document &Doc, const std::optional<Lex::TextEdit> Edit)
+        noexcept
+    {
+        Doc.LineStartList.assign(1, 0);
+        for (auto I = size_t(); I != Doc.Text.size(); I++) {
+            if (Doc.Text[I] == '\n') {
+                Doc.LineStartList.emplace_back(static_cast<uint32_t>(I + 1));
+            }
+        }
+
+        Doc.SrcBufferList.emplace_back(
+            ADT::SourceBuffer::FromString(Doc.Text));
+
+        auto Diag = BufferedDiagnosticConsumer();
+        const auto Options = Parse::ParseOptions();
+
+        // Every edit keeps the buffers of the last ones alive, so once there
+        // are enough of them the document is parsed in full again, which
+        // frees them.
+
+        if (Edit.has_value() &&
+            Doc.Unit.has_value() &&
+            Doc.SrcBufferList.size() <= MaxEditBufferCount)
+        {
+            auto Result =
+                Lex::TokenBuffer::CreateByEditing(*Doc.TokenBuffer,
+                                                  Doc.getSrcBuffer(),
+                                                  Edit.value(), Diag);
+
+            if (Result.has_value()) {
+                auto &[TokenBuffer, TokenEdit] = Result.value();
+                Doc.TokenBuffer.emplace(std::move(TokenBuffer));
+                Doc.Unit.emplace(
+                    Parse::ParseUnit::CreateByEditing(std::move(*Doc.Unit),
+                                                      *Doc.TokenBuffer,
+                                                      TokenEdit, Diag,
+                                                      Options));
+
+                UpdateDiagnostics(Doc, Diag.getMessageList());
+
+                auto SemaDiag = BufferedDiagnosticConsumer();
+                const auto ResolvedList =
+                    Sema::ResolveChangedNames(*Doc.Unit, Doc.Graph, SemaDiag);
+
+                UpdateSemaDiagnostics(Doc, ResolvedList,
+                                      SemaDiag.getMessageList());
+                return;
+            }
+
+            // The edit left an invalid token behind. Lex the whole buffer so
+            // the error is reported.
+            Diag = BufferedDiagnosticConsumer();
+        }
+
+        Doc.StmtDiagMap.clear();
+        Doc.Unit.reset();
+        Doc.TokenBuffer.reset();
+        Doc.Graph.clear();
+
+        // Nothing points into the older buffers anymore.
+        Doc.SrcBufferList.erase(Doc.SrcBufferList.begin(),
+                                Doc.SrcBufferList.end() - 1);
+
+        auto TokenBuffer = Lex::TokenBuffer::Create(Doc.getSrcBuffer(), Diag);
+        if (!TokenBuffer.has_value()) {
+            Doc.TokenBuffer.reset();
+            UpdateDiagnostics(Doc, Diag.getMessageList());
+
+            return;
+        }
+
+        Doc.TokenBuffer.emplace(std::move(TokenBuffer.value()));
+        Doc.Unit.emplace(
+            Parse::ParseUnit::Create(*Doc.TokenBuffer, Diag, Options));
+
+        UpdateDiagnostics(Doc, Diag.getMessageList());
+
+        auto SemaDiag = BufferedDiagnosticConsumer();
+        Sema::ResolveNames(*Doc.Unit, SemaDiag, &Doc.Graph);
+
+        UpdateSemaDiagnostics(Doc, Doc.Unit->getTopLevelStmtList(),
+                              SemaDiag.getMessageList());
+    }
+
+    static void
+    PublishDiagnostics(const std::string_view Uri,
+                       const Document &Doc) noexcept
+    {
+        auto MessageList = std::vector<const DiagnosticMessage *>();
+        for (const auto &[Stmt, Info] : Doc.StmtDiagMap) {
+            for (const auto &Message : Info.MessageList) {
+                MessageList.emplace_back(&Message);
+            }
+
+            for (const auto &Message : Info.SemaMessageList) {
+                MessageList.emplace_back(&Message);
+            }
+        }
+
+        for (const auto &Message : Doc.OtherDiagList) {
+            MessageList.emplace_back(&Message);
+        }
+
+        std::ranges::stable_sort(MessageList, std::less(),
+                                 [](const DiagnosticMessage *const Message) {
+                                     return Message->Location.Index;
+                                 });
+
+        auto DiagList = llvm::json::Array();
+        for (const auto Message : MessageList) {
+            // Underline the token at the message's location, if there is one.
+
+            const auto Begin =
+                std::min(Message->Location.Index,
+                         static_cast<uint32_t>(Doc.Text.size()));
+
+            auto End = Begin;
+            if (const auto Token = FindTokenAtOffset(Doc, Begin)) {
+                if (Token->Loc.Index == Begin) {
+                    End = Token->End.Index;
+                }
+            }
+
+            auto Severity = 3;
+            switch (Message->Level) {
+                case DiagnosticLevel::Note:
+                    Severity = 3;
+                    break;
+                case DiagnosticLevel::Warning:
+                    Severity = 2;
+                    break;
+                case DiagnosticLevel::Error:
+                    Severity = 1;
+                    break;
+            }
+
+            DiagList.emplace_back(llvm::json::Object {
+                { "range", GetRange(Doc, Begin, End) },
+                { "severity", Severity },
+                { "source", "compiler" },
+                { "message", Message->Message }
+            });
+        }
+
+        SendMessage(llvm::json::Object {
+            { "jsonrpc", "2.0" },
+            { "method", "textDocument/publishDiagnostics" },
+            {
+                "params",
+                llvm::json::Object {
+                    { "uri", std::string(Uri) },
+                    { "diagnostics", std::move(DiagList) }
+                }
+            }
+        });
+    }
+
+    struct LanguageServer {
+    protected:
+        std::unordered_map<std::string, Document> DocumentMap;
+        bool ReceivedShutdown : 1 = false;
+
+        [[nodiscard]] static auto
+        getDocumentUri(const llvm::json::Object &Params) noexcept
+            -> std::optional<std::string_view>
+        {
+            if (const auto TextDocument = Params.getObject("textDocument")) {
+                if (const auto Uri = TextDocument->getString("uri")) {
+                    return std::string_view(*Uri);
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]] auto
+        findDocument(const llvm::json::Object &Params) noexcept
+            -> std::pair<std::string_view, Document *>
+        {
+            const auto Uri = getDocumentUri(Params);
+            if (!Uri.has_value()) {
+                return std::pair(std::string_view(), nullptr);
+            }
+
+            const auto Iter = this->DocumentMap.find(std::string(Uri.value()));
+            if (Iter == this->DocumentMap.end()) {
+                return std::pair(Uri.value(), nullptr);
+            }
+
+            return std::pair(std::string_view(Iter->first), &Iter->second);
+        }
+
+        void didOpen(const llvm::json::Object &Params) noexcept {
+            const auto TextDocument = Params.getObject("textDocument");
+            if (TextDocument == nullptr) {
+                return;
+            }
+
+            const auto Uri = TextDocument->getString("uri");
+            const auto Text = TextDocument->getString("text");
+
+            if (!Uri || !Text) {
+                return;
+            }
+
+            // Documents can't be assigned, as token-buffers can't be.
+            this->DocumentMap.erase(Uri->str());
+
+            auto &Doc = this->DocumentMap[Uri->str()];
+            Doc.Text = Text->str();
+
+            Analyze(Doc, std::nullopt);
+            PublishDiagnostics(*Uri, Doc);
+        }
+
+        void didChange(const llvm::json::Object &Params) noexcept {
+            const auto [Uri, Doc] = this->findDocument(Params);
+            const auto ChangeList = Params.getArray("contentChanges");
+
+            if (Doc == nullptr || ChangeList == nullptr) {
+                return;
+            }
+
+            for (const auto &ChangeValue : *ChangeList) {
+                const auto Change = ChangeValue.getAsObject();
+                if (Change == nullptr) {
+                    continue;
+                }
+
+                const auto Text = Change->getString("text");
+                if (!Text) {
+                    continue;
+                }
+
+                const auto Range = Change->getObject("range");
+                if (Range == nullptr) {
+                    Doc->Text = Text->str();
+                    Analyze(*Doc, std::nullopt);
+
+                    continue;
+                }
+
+                const auto Start = Range->getObject("start");
+                const auto End = Range->getObject("end");
+
+                if (Start == nullptr || End == nullptr) {
+                    continue;
+                }
+
+                const auto Begin = GetOffsetForPosition(*Doc, *Start);
+                const auto RemovedLength =
+                    std::max(GetOffsetForPosition(*Doc, *End), Begin) - Begin;
+
+                Doc->Text.replace(Begin, RemovedLength, Text->str());
+                Analyze(*Doc, Lex::TextEdit {
+                    .Offset = Begin,
+                    .RemovedLength = RemovedLength,
+                    .InsertedLength = static_cast<uint32_t>(Text->size())
+                });
+            }
+
+            PublishDiagnostics(Uri, *Doc);
+        }
+
+        void didClose(const llvm::json::Object &Params) noexcept {
+            if (const auto Uri = getDocumentUri(Params)) {
+                this->DocumentMap.erase(std::string(Uri.value()));
+                SendMessage(llvm::json::Object {
+                    { "jsonrpc", "2.0" },
+                    { "method", "textDocument/publishDiagnostics" },
+                    {
+                        "params",
+                        llvm::json::Object {
+                            { "uri", std::string(Uri.value()) },
+                            { "diagnostics", llvm::json::Array() }
+                        }
+                    }
+                });
+            }
+        }
+
+        [[nodiscard]]
+        auto definition(const llvm::json::Object &Params) noexcept
+            -> llvm::json::Value
+        {
+            const auto [Uri, Doc] = this->findDocument(Params);
+            const auto Position = Params.getObject("position");
+
+            if (Doc == nullptr || Position == nullptr) {
+                return nullptr;
+            }
+
+            const auto Offset = GetOffsetForPosition(*Doc, *Position);
+            const auto Range = FindDefinition(*Doc, Offset);
+
+            if (!Range.has_value()) {
+                return nullptr;
+            }
+
+            return llvm::json::Object {
+                { "uri", std::string(Uri) },
+                { "range", GetRange(*Doc, Range->first, Range->second) }
+            };
+        }
+
+        [[nodiscard]]
+        auto documentSymbol(const llvm::json::Object &Params) noexcept
+            -> llvm::json::Value
+        {
+            const auto [Uri, Doc] = this->findDocument(Params);
+            if (Doc == nullptr) {
+                return nullptr;
+            }
+
+            return GetDocumentSymbolList(*Doc);
+        }
+    public:
+        explicit LanguageServer() noexcept = default;
+
+        // Returns the exit code once the client asks the server to exit.
+        [[nodiscard]] auto handle(const llvm::json::Object &Message) noexcept
+            -> std::optional<int>
+        {
+            const auto Method = Message.getString("method");
+            if (!Method) {
+                // A response to a request of ours, which we never send.
+                return std::nullopt;
+            }
+
+            // Notifications have no id.
+            const auto NullId = llvm::json::Value(nullptr);
+            const auto IdPtr = Message.get("id");
+            const auto &Id = IdPtr != nullptr ? *IdPtr : NullId;
+
+            const auto EmptyParams = llvm::json::Object();
+
+            auto Params = Message.getObject("params");
+            if (Params == nullptr) {
+                Params = &EmptyParams;
+            }
+
+            if (*Method == "initialize") {
+                SendResult(Id, llvm::json::Object {
+                    {
+                        "capabilities",
+                        llvm::json::Object {
+                            {
+                                "textDocumentSync",
+                                llvm::json::Object {
+                                    { "openClose", true },
+                                    // Incremental
+                                    { "change", 2 }
+                                }
+                            },
+                            { "definitionProvider", true },
+                            { "documentSymbolProvider", true }
+                        }
+                    },
+                    {
+                        "serverInfo",
+                        llvm::json::Object { { "name", "compiler" } }
+                    }
+                });
+            } else if (*Method == "textDocument/didOpen") {
+                this->didOpen(*Params);
+            } else if (*Method == "textDocument/didChange") {
+                this->didChange(*Params);
+            } else if (*Method == "textDocument/didClose") {
+                this->didClose(*Params);
+            } else if (*Method == "textDocument/definition") {
+                SendResult(Id, this->definition(*Params));
+            } else if (*Method == "textDocument/documentSymbol") {
+                SendResult(Id, this->documentSymbol(*Params));
+            } else if (*Method == "shutdown") {
+                this->ReceivedShutdown = true;
+                SendResult(Id, nullptr);
+            } else if (*Method == "exit") {
+                return this->ReceivedShutdown ? 0 : 1;
+            } else if (IdPtr != nullptr) {
+                SendError(Id, ErrorCode::MethodNotFound,
+                          std::format("Unsupported method: {}",
+                                      std::string_view(*Method)));
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    auto RunLanguageServer() noexcept -> int {
+        auto Server = LanguageServer();
+        auto Body = std::string();
+
+        while (ReadMessage(Body)) {
+            auto MessageOrErr = llvm::json::parse(Body);
+            if (!MessageOrErr) {
+                llvm::consumeError(MessageOrErr.takeError());
+                continue;
+            }
+
+            const auto Message = MessageOrErr->getAsObject();
+            if (Message == nullptr) {
+                continue;
+            }
+
+            if (const auto ExitCode = Server.handle(*Message)) {
+                return ExitCode.value();
+            }
+        }
+
+        return 1;
+    }
+}
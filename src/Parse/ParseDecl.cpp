@@ -200,7 +200,7 @@ namespace Parse {
     [[nodiscard]] static auto
     ParseFieldList(ParseContext &Context,
                    const bool AllowOptionalFields,
-                   std::vector<AST::Stmt *> &FieldList) noexcept -> ParseError
+                   std::span<AST::Stmt *> &FieldList) noexcept -> ParseError
     {
         const auto CloseTokenKindList = { Lex::TokenKind::CloseCurlyBrace };
         auto Result =
@@ -228,11 +228,11 @@ namespace Parse {
     [[nodiscard]] static auto
     ParseArrayBindingItemList(ParseContext &Context,
                               Lex::Token BracketToken) noexcept
-        -> std::expected<std::vector<AST::ArrayBindingItem *>, ParseError>;
+        -> std::expected<std::span<AST::ArrayBindingItem *>, ParseError>;
 
     [[nodiscard]]
     static auto ParseObjectBindingFieldList(ParseContext &Context) noexcept
-        -> std::expected<std::vector<AST::ObjectBindingField *>, ParseError>;
+        -> std::expected<std::span<AST::ObjectBindingField *>, ParseError>;
 
     [[nodiscard]]
     static auto ParseSingleFunctionParam(ParseContext &Context) noexcept
@@ -313,7 +313,7 @@ namespace Parse {
 
     [[nodiscard]]
     static auto ParseFunctionParamList(ParseContext &Context) noexcept
-        -> std::expected<std::vector<AST::Stmt *>, ParseError>
+        -> std::expected<std::span<AST::Stmt *>, ParseError>
     {
         const auto CloseTokenKindList = { Lex::TokenKind::CloseParen };
         const auto Result =
@@ -554,7 +554,7 @@ namespace Parse {
     [[nodiscard]] static auto
     ParseClosureCaptureList(ParseContext &Context,
                             const Lex::Token BracketToken) noexcept
-        -> std::expected<std::vector<AST::Stmt *>, ParseError>
+        -> std::expected<std::span<AST::Stmt *>, ParseError>
     {
         const auto Parser =
             [=](ParseContext &Context) noexcept
@@ -713,7 +713,7 @@ namespace Parse {
         auto &Diag = Context.Diag;
         auto &TokenStream = Context.TokenStream;
 
-        auto FieldList = std::vector<AST::Stmt *>();
+        auto FieldList = std::span<AST::Stmt *>();
         if (TokenStream.consumeIfIs(Lex::TokenKind::OpenCurlyBrace)) {
             if (const auto Error =
                     ParseFieldList(Context, /*AllowOptionalFields=*/true,
@@ -778,7 +778,7 @@ namespace Parse {
         auto &Diag = Context.Diag;
         auto &TokenStream = Context.TokenStream;
 
-        auto FieldList = std::vector<AST::Stmt *>();
+        auto FieldList = std::span<AST::Stmt *>();
         if (TokenStream.consumeIfIs(Lex::TokenKind::OpenCurlyBrace)) {
             if (const auto Error =
                     ParseFieldList(Context, /*AllowOptionalFields=*/true,
@@ -842,7 +842,7 @@ namespace Parse {
         auto &Diag = Context.Diag;
         auto &TokenStream = Context.TokenStream;
 
-        auto FieldList = std::vector<AST::Stmt *>();
+        auto FieldList = std::span<AST::Stmt *>();
         if (const auto CurlyTokenOpt =
                 TokenStream.consumeIfIs(Lex::TokenKind::OpenCurlyBrace))
         {
@@ -909,7 +909,7 @@ namespace Parse {
         auto &Diag = Context.Diag;
         auto &TokenStream = Context.TokenStream;
 
-        auto FieldList = std::vector<AST::Stmt *>();
+        auto FieldList = std::span<AST::Stmt *>();
         if (TokenStream.consumeIfIs(Lex::TokenKind::OpenCurlyBrace)) {
             if (const auto Error =
                     ParseFieldList(Context, /*AllowOptionalFields=*/false,
@@ -1063,7 +1063,7 @@ namespace Parse {
     [[nodiscard]] static auto
     ParseArrayBindingItemList(ParseContext &Context,
                               const Lex::Token BracketToken) noexcept
-        -> std::expected<std::vector<AST::ArrayBindingItem *>, ParseError>;
+        -> std::expected<std::span<AST::ArrayBindingItem *>, ParseError>;
 
     [[nodiscard]] static auto
     ParseSingleArrayBindingItem(ParseContext &Context) noexcept
@@ -1200,7 +1200,7 @@ namespace Parse {
     static auto
     ParseArrayBindingItemList(ParseContext &Context,
                               const Lex::Token BracketToken) noexcept
-        -> std::expected<std::vector<AST::ArrayBindingItem *>, ParseError>
+        -> std::expected<std::span<AST::ArrayBindingItem *>, ParseError>
     {
         const auto CloseTokenKindList = { Lex::TokenKind::RightSquareBracket };
         return
@@ -1393,7 +1393,7 @@ namespace Parse {
 
     static auto
     ParseObjectBindingFieldList(ParseContext &Context) noexcept
-        -> std::expected<std::vector<AST::ObjectBindingField *>, ParseError>
+        -> std::expected<std::span<AST::ObjectBindingField *>, ParseError>
     {
         const auto CloseTokenKindList = { Lex::TokenKind::CloseCurlyBrace };
         return
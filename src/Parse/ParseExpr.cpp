@@ -38,7 +38,7 @@ namespace Parse {
     ParseArrayDetailListExceptCloseBracket(
         ParseContext &Context,
         const Lex::Token BracketToken) noexcept
-            -> std::expected<std::vector<AST::Stmt *>, ParseError>
+            -> std::expected<std::span<AST::Stmt *>, ParseError>
     {
         const auto EndTokenKindList = {
             Lex::TokenKind::Semicolon,
@@ -79,8 +79,8 @@ namespace Parse {
     }
 
     [[nodiscard]] static auto
-    IsLikelyParamList(Lex::TokenStream &TokenStream,
-                      const bool FromClosureDecl) noexcept
+    IsLikelyParamListUncached(Lex::TokenStream &TokenStream,
+                              const bool FromClosureDecl) noexcept
         -> std::optional<bool>
     {
         if (TokenStream.consumeIfIs(Lex::TokenKind::CloseParen)) {
@@ -154,6 +154,20 @@ namespace Parse {
         return Result;
     }
 
+    [[nodiscard]] static auto
+    IsLikelyParamList(ParseContext &Context, const bool FromClosureDecl) noexcept
+        -> std::optional<bool>
+    {
+        auto &TokenStream = Context.TokenStream;
+        const auto Kind =
+            FromClosureDecl ? ProbeKind::ClosureParamList : ProbeKind::ParamList;
+
+        return Context.ProbeCache.getOrRun<std::optional<bool>>(
+            Kind, TokenStream.position(), [&]() noexcept {
+                return IsLikelyParamListUncached(TokenStream, FromClosureDecl);
+            });
+    }
+
     [[nodiscard]] static auto
     ParseArrayTypeAndArrayPointerTypeBase(
         ParseContext &Context,
@@ -400,8 +414,8 @@ namespace Parse {
         -> std::expected<ArrayKind, ParseError>
     {
         auto &TokenStream = Context.TokenStream;
-        const auto Result =
-            TokenStream.inWindow(
+        const auto Probe = [&TokenStream]() noexcept {
+            return TokenStream.inWindow(
                 [](Lex::TokenStream &TokenStream) noexcept
                     -> std::expected<ArrayKind, ParseError>
                 {
@@ -453,8 +467,11 @@ namespace Parse {
                         return ArrayKind::ArrayType;
                     }
                 });
+        };
 
-        return Result;
+        using ResultType = std::expected<ArrayKind, ParseError>;
+        return Context.ProbeCache.getOrRun<ResultType>(
+            ProbeKind::SquareBracketArrayKind, TokenStream.position(), Probe);
     }
 
     [[nodiscard]] static auto
@@ -483,36 +500,43 @@ namespace Parse {
             TokenStream.goToPosition(Position - 1);
         }
 
-        const auto IsClosureCaptureList =
-            TokenStream.inWindow([](Lex::TokenStream &TokenStream) noexcept {
-                const auto TokenOpt =
-                    TokenStream.findNextAndConsume(
-                        Lex::TokenKind::RightSquareBracket);
+        const auto ProbeClosureCaptureList = [&Context]() noexcept {
+            return Context.TokenStream.inWindow(
+                [&Context](Lex::TokenStream &TokenStream) noexcept {
+                    const auto TokenOpt =
+                        TokenStream.findNextAndConsume(
+                            Lex::TokenKind::RightSquareBracket);
 
-                if (!TokenOpt.has_value()) {
-                    return false;
-                }
+                    if (!TokenOpt.has_value()) {
+                        return false;
+                    }
 
-                const auto NextTokenOpt = TokenStream.peek();
-                if (!NextTokenOpt.has_value()) {
-                    return false;
-                }
+                    const auto NextTokenOpt = TokenStream.peek();
+                    if (!NextTokenOpt.has_value()) {
+                        return false;
+                    }
 
-                const auto NextToken = NextTokenOpt.value();
-                if (NextToken.Kind != Lex::TokenKind::OpenParen) {
-                    return false;
-                }
+                    const auto NextToken = NextTokenOpt.value();
+                    if (NextToken.Kind != Lex::TokenKind::OpenParen) {
+                        return false;
+                    }
 
-                TokenStream.consume();
-                if (const auto IsParamListOpt =
-                        IsLikelyParamList(TokenStream,
-                                          /*FromClosureDecl=*/true))
-                {
-                    return IsParamListOpt.value();
-                }
+                    TokenStream.consume();
+                    const auto IsParamListOpt =
+                        IsLikelyParamList(Context, /*FromClosureDecl=*/true);
 
-                return false;
-            });
+                    if (IsParamListOpt.has_value()) {
+                        return IsParamListOpt.value();
+                    }
+
+                    return false;
+                });
+        };
+
+        const auto IsClosureCaptureList =
+            Context.ProbeCache.getOrRun<bool>(ProbeKind::ClosureCaptureList,
+                                              TokenStream.position(),
+                                              ProbeClosureCaptureList);
 
         if (IsClosureCaptureList) {
             return ParseClosureDecl(Context, BracketToken);
@@ -992,7 +1016,7 @@ namespace Parse {
         // parenthesis, or a parenthesis with an identifier.
 
         if (const auto IsParamListOpt =
-                IsLikelyParamList(TokenStream, /*FromClosureDecl=*/false))
+                IsLikelyParamList(Context, /*FromClosureDecl=*/false))
         {
             if (IsParamListOpt.value()) {
                 const auto FuncOpt =
@@ -1056,13 +1080,13 @@ namespace Parse {
         auto &Diag = Context.Diag;
         auto &TokenStream = Context.TokenStream;
 
-        const auto ParseResult = ParseNumber(TokenStream.tokenContent(Token));
+        const auto &ParseResult = TokenStream.tokenNumber(Token);
         switch (ParseResult.Error.Kind) {
-            case ParseNumberErrorKind::None:
+            case Lex::ParseNumberErrorKind::None:
                 break;
-            case ParseNumberErrorKind::EmptyString:
+            case Lex::ParseNumberErrorKind::EmptyString:
                 assert(false && "NumberLiteral token-string is empty");
-            case ParseNumberErrorKind::NegativeNumber:
+            case Lex::ParseNumberErrorKind::NegativeNumber:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
@@ -1070,7 +1094,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::PositiveSign:
+            case Lex::ParseNumberErrorKind::PositiveSign:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
@@ -1078,7 +1102,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::InvalidDigit:
+            case Lex::ParseNumberErrorKind::InvalidDigit:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location =
@@ -1087,7 +1111,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::UnrecognizedChar:
+            case Lex::ParseNumberErrorKind::UnrecognizedChar:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location =
@@ -1096,7 +1120,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::UnrecognizedBase:
+            case Lex::ParseNumberErrorKind::UnrecognizedBase:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location =
@@ -1105,7 +1129,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::TooLarge:
+            case Lex::ParseNumberErrorKind::TooLarge:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
@@ -1113,7 +1137,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::LeadingZero:
+            case Lex::ParseNumberErrorKind::LeadingZero:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
@@ -1121,7 +1145,7 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::NegativeZero:
+            case Lex::ParseNumberErrorKind::NegativeZero:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
@@ -1129,15 +1153,15 @@ namespace Parse {
                 });
 
                 break;
-            case ParseNumberErrorKind::FloatingPoint:
+            case Lex::ParseNumberErrorKind::FloatingPoint:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
-                    .Message = "Floating-point number not supported"
+                    .Message = "Floating-point numbers must be in base 10"
                 });
 
                 break;
-            case ParseNumberErrorKind::Overflow:
+            case Lex::ParseNumberErrorKind::Overflow:
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
                     .Location = Token.Loc,
@@ -1154,13 +1178,9 @@ namespace Parse {
     ParseUnaryOperation(ParseContext &Context, const Lex::Token Token) noexcept
         -> std::expected<AST::Expr *, ParseError>
     {
-        auto &TokenStream = Context.TokenStream;
-
-        const auto TokenString = TokenStream.tokenContent(Token);
-        const auto UnaryOpOpt = UnaryOperatorToLexemeMap.keyFor(TokenString);
-
+        const auto UnaryOpOpt = LexTokenToUnaryOperator(Token);
         assert(UnaryOpOpt.has_value() &&
-               "Unary operator not found in lexeme map");
+               "Unary operator not found for token");
 
         const auto UnaryOp = UnaryOpOpt.value();
         if (UnaryOp == UnaryOperator::Optional) {
@@ -3,6 +3,9 @@
  * © suhas pai
  */
 
+#include <cstring>
+
+#include "ADT/BumpAllocator.h"
 #include "Basic/Lexer.h"
 #include "Misc/Utils.h"
 
@@ -125,17 +128,38 @@ namespace Parse {
         const auto StringTokenString =
             StringTokenContent.substr(1, StringTokenContent.length() - 2);
 
-        auto String = std::string();
-        auto Lexer = ::Lexer(StringTokenString);
+        // Most literals have no escape-sequences, and can point directly into
+        // the source-buffer. find() is backed by memchr(), which scans many
+        // bytes at a time.
 
-        while (!Lexer.finished()) {
-            const auto Char = Lexer.consume();
-            if (Char != '\\') {
-                String.push_back(Char);
-                continue;
-            }
+        auto EscapePos = StringTokenString.find('\\');
+        if (EscapePos == std::string_view::npos) {
+            return new AST::StringLiteral(StringToken.Loc, StringTokenString);
+        }
+
+        // Decoding never makes a string longer, so the decoded string fits in
+        // a buffer the size of the literal.
+
+        const auto Buffer =
+            static_cast<char *>(
+                ADT::BumpAllocator::threadLocal().allocate(
+                    StringTokenString.length(), alignof(char)));
+
+        auto Length = size_t();
+        auto CopyBegin = size_t();
+
+        do {
+            const auto CopyLength = EscapePos - CopyBegin;
 
+            std::memcpy(Buffer + Length,
+                        StringTokenString.data() + CopyBegin,
+                        CopyLength);
+
+            Length += CopyLength;
+
+            auto Lexer = ::Lexer(StringTokenString.substr(EscapePos + 1));
             const auto NextChar = Lexer.consume();
+
             if (NextChar == '\0') {
                 Diag.consume({
                     .Level = DiagnosticLevel::Error,
@@ -159,9 +183,19 @@ namespace Parse {
                 return nullptr;
             }
 
-            String.push_back(EscapedChar);
-        }
+            Buffer[Length++] = EscapedChar;
+
+            CopyBegin = EscapePos + 1 + Lexer.index();
+            EscapePos = StringTokenString.find('\\', CopyBegin);
+        } while (EscapePos != std::string_view::npos);
+
+        const auto TailLength = StringTokenString.length() - CopyBegin;
+        std::memcpy(Buffer + Length,
+                    StringTokenString.data() + CopyBegin,
+                    TailLength);
 
-        return new AST::StringLiteral(StringToken.Loc, std::move(String));
+        Length += TailLength;
+        return new AST::StringLiteral(StringToken.Loc,
+                                      std::string_view(Buffer, Length));
     }
-}
\ No newline at end of file
+}
@@ -3,9 +3,12 @@
  * © suhas pai
  */
 
+#include <thread>
+
 #include "AST/BinaryOperation.h"
 #include "AST/Decls/FunctionDecl.h"
 #include "AST/Decls/ObjectBindingVarDecl.h"
+#include "AST/ShiftLocations.h"
 
 #include "llvm/Support/Casting.h"
 
@@ -147,15 +150,18 @@ namespace Parse {
         }
     }
 
-    auto ParseUnit::addTopLevelStmt(AST::Stmt *const Stmt) noexcept -> AddError
+    auto
+    ParseUnit::addTopLevelStmt(AST::Stmt *const Stmt,
+                               const TokenRange Range) noexcept -> AddError
     {
         this->TopLevelStmtList.emplace_back(Stmt);
+        this->TopLevelStmtRangeList.emplace_back(Range);
         if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(Stmt)) {
             if (!this->TopLevelDeclList.contains(Decl->getName())) {
+                this->TopLevelDeclList.emplace(Decl->getName(), Decl);
                 return AddError::none();
             }
 
-            this->TopLevelDeclList.emplace(Decl->getName(), Decl);
             return AddError::WithNameList({
                 ParseUnit::AddError::DeclName(Decl->getName(),
                                               Decl->getNameLoc())
@@ -188,70 +194,488 @@ namespace Parse {
         return AddError::none();
     }
 
+    static auto ParseTopLevelStmt(ParseContext &Context) noexcept
+        -> std::expected<AST::Stmt *, ParseError>
+    {
+        auto &Diag = Context.Diag;
+        auto &TokenStream = Context.TokenStream;
+
+        const auto StmtOpt = ParseStmt(Context);
+        if (!StmtOpt.has_value()) {
+            return StmtOpt;
+        }
+
+        const auto Stmt = StmtOpt.value();
+        if (Stmt == nullptr) {
+            return Stmt;
+        }
+
+        if (!Context.Options.IgnoreUnusedExpressions) {
+            if (const auto Expr = llvm::dyn_cast<AST::Expr>(Stmt)){
+                const auto BinOp = llvm::dyn_cast<AST::BinaryOperation>(Stmt);
+                if (BinOp == nullptr || !BinOp->isAssignmentOperation()) {
+                    Diag.consume({
+                        .Level = DiagnosticLevel::Warning,
+                        .Location = Expr->getLoc(),
+                        .Message = "Expression result unused"
+                    });
+                }
+            }
+        }
+
+        // All top level statements need ending semicolons, except top level
+        // functions and if-statements.
+
+        if (!llvm::isa<AST::FunctionDecl>(Stmt) &&
+            !llvm::isa<AST::IfExpr>(Stmt))
+        {
+            if (!ExpectSemicolon(Context)) {
+                Diag.consume({
+                    .Level = DiagnosticLevel::Error,
+                    .Location = TokenStream.getCurrentOrPreviousLocation(),
+                    .Message = "Expected a semicolon after declaration"
+                });
+            }
+        }
+
+        return Stmt;
+    }
+
+    static void
+    AddTopLevelStmt(ParseUnit &Unit,
+                    AST::Stmt *const Stmt,
+                    const ParseUnit::TokenRange Range,
+                    DiagnosticConsumer &Diag) noexcept
+    {
+        if (const auto Error = Unit.addTopLevelStmt(Stmt, Range)) {
+            // TODO:
+            // Use ranges::join_with when it is available in llvm's libc++.
+
+            Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Error.DeclNameList.front().Loc,
+                .Message =
+                    std::format("Decl name '{}' is reused",
+                                Error.DeclNameList.front().Name),
+                .IsReusedDeclName = true
+            });
+        }
+    }
+
+    // Parses top-level statements until the token-stream reaches End. Returns
+    // false if the parser could not proceed, in which case parsing of the file
+    // stops.
+
+    static auto
+    ParseTopLevelStmtRange(ParseContext &Context,
+                           ParseUnit &Unit,
+                           const uint32_t End) noexcept -> bool
+    {
+        auto &TokenStream = Context.TokenStream;
+        while (TokenStream.position() < End && !TokenStream.reachedEof()) {
+            const auto Begin = TokenStream.position();
+            const auto StmtOpt = ParseTopLevelStmt(Context);
+
+            if (!StmtOpt.has_value()) {
+                return false;
+            }
+
+            if (const auto Stmt = StmtOpt.value()) {
+                AddTopLevelStmt(Unit, Stmt, {
+                    .Begin = Begin,
+                    .End = TokenStream.position()
+                }, Context.Diag);
+            }
+        }
+
+        return true;
+    }
+
+    // Below this many tokens, starting threads costs more than it saves.
+    constexpr static auto ParallelParseMinTokenCount = 1 << 14;
+
+    // Find the token index following every top-level statement. A statement
+    // ends at a semicolon at depth 0, or at the closing curly-brace of a
+    // top-level function, struct, or enum.
+    //
+    // These boundaries are only a guess made without parsing. The parser may
+    // still read past a boundary, which the merge step in ParseInParallel()
+    // detects and recovers from.
+
+    static auto
+    FindTopLevelStmtBoundaries(const Lex::TokenBuffer &TokenBuffer) noexcept
+        -> std::vector<uint32_t>
+    {
+        const auto Text = TokenBuffer.getSourceBuffer().text();
+        const auto TokenList = TokenBuffer.getTokenList();
+
+        auto Result = std::vector<uint32_t>();
+        auto Depth = uint32_t();
+
+        auto AtStmtStart = true;
+        auto EndsAtCloseCurly = false;
+
+        for (auto I = uint32_t(); I != TokenList.size(); I++) {
+            const auto Token = TokenList[I];
+            if (AtStmtStart && Token.Kind == Lex::TokenKind::Keyword) {
+                switch (Lex::KeywordLexemeGetKeyword(Token.getString(Text))) {
+                    case Lex::Keyword::Function:
+                    case Lex::Keyword::Struct:
+                    case Lex::Keyword::Enum:
+                        EndsAtCloseCurly = true;
+                        AtStmtStart = false;
+
+                        break;
+                    case Lex::Keyword::Mut:
+                    case Lex::Keyword::Volatile:
+                    case Lex::Keyword::Inline:
+                    case Lex::Keyword::Comptime:
+                    case Lex::Keyword::Discardable:
+                        // Qualifiers can precede the introducer.
+                        break;
+                    default:
+                        AtStmtStart = false;
+                        break;
+                }
+
+                continue;
+            }
+
+            AtStmtStart = false;
+            switch (Token.Kind) {
+                case Lex::TokenKind::OpenParen:
+                case Lex::TokenKind::OpenCurlyBrace:
+                case Lex::TokenKind::LeftSquareBracket:
+                    Depth++;
+                    break;
+                case Lex::TokenKind::CloseParen:
+                case Lex::TokenKind::RightSquareBracket:
+                    if (Depth != 0) {
+                        Depth--;
+                    }
+
+                    break;
+                case Lex::TokenKind::CloseCurlyBrace:
+                    if (Depth != 0) {
+                        Depth--;
+                    }
+
+                    if (Depth != 0 || !EndsAtCloseCurly) {
+                        break;
+                    }
+
+                    // A struct or enum may still be followed by a semicolon,
+                    // which then ends the statement instead.
+
+                    if (I + 1 != TokenList.size() &&
+                        TokenList[I + 1].Kind == Lex::TokenKind::Semicolon)
+                    {
+                        break;
+                    }
+
+                    Result.emplace_back(I + 1);
+
+                    AtStmtStart = true;
+                    EndsAtCloseCurly = false;
+
+                    break;
+                case Lex::TokenKind::Semicolon:
+                    if (Depth != 0) {
+                        break;
+                    }
+
+                    Result.emplace_back(I + 1);
+
+                    AtStmtStart = true;
+                    EndsAtCloseCurly = false;
+
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        return Result;
+    }
+
+    struct ParsedTopLevelStmt {
+        AST::Stmt *Stmt;
+        ParseUnit::TokenRange Range;
+
+        // Number of messages in the range's diagnostic buffer once this
+        // statement was parsed, so messages can be replayed in source order.
+        size_t DiagMessageEnd;
+    };
+
+    struct ParsedTopLevelRange {
+        uint32_t Begin;
+        uint32_t End;
+
+        // Position of the token-stream when parsing stopped. May be past End
+        // if the boundary guess was wrong.
+        uint32_t StoppedAt = 0;
+        bool CouldNotProceed : 1 = false;
+
+        std::vector<ParsedTopLevelStmt> StmtList;
+        BufferedDiagnosticConsumer Diag = BufferedDiagnosticConsumer();
+    };
+
+    static void
+    ParseTopLevelRangeInWorker(const Lex::TokenBuffer &TokenBuffer,
+                               const ParseOptions Options,
+                               ParsedTopLevelRange &Range) noexcept
+    {
+        auto TokenStream = Lex::TokenStream(TokenBuffer);
+        auto Context = ParseContext(TokenStream, Range.Diag, Options);
+
+        TokenStream.goToPosition(Range.Begin);
+        while (TokenStream.position() < Range.End &&
+               !TokenStream.reachedEof())
+        {
+            const auto Begin = TokenStream.position();
+            const auto StmtOpt = ParseTopLevelStmt(Context);
+
+            if (!StmtOpt.has_value()) {
+                Range.CouldNotProceed = true;
+                break;
+            }
+
+            if (const auto Stmt = StmtOpt.value()) {
+                Range.StmtList.push_back({
+                    .Stmt = Stmt,
+                    .Range = {
+                        .Begin = Begin,
+                        .End = TokenStream.position()
+                    },
+                    .DiagMessageEnd = Range.Diag.messageCount()
+                });
+            }
+        }
+
+        Range.StoppedAt = TokenStream.position();
+    }
+
+    // Returns false if parallel parsing was not worth it for this file, in
+    // which case nothing was added to Unit.
+
+    static auto
+    ParseInParallel(const Lex::TokenBuffer &TokenBuffer,
+                    DiagnosticConsumer &Diag,
+                    const ParseOptions Options,
+                    ParseUnit &Unit) noexcept -> bool
+    {
+        const auto TokenCount =
+            static_cast<uint32_t>(TokenBuffer.getTokenList().size());
+
+        const auto ThreadCount = std::thread::hardware_concurrency();
+        if (TokenCount < ParallelParseMinTokenCount || ThreadCount < 2) {
+            return false;
+        }
+
+        const auto BoundaryList = FindTopLevelStmtBoundaries(TokenBuffer);
+        if (BoundaryList.size() < 2) {
+            return false;
+        }
+
+        // Split the file into one range of roughly equal token count per
+        // thread, cutting only at statement boundaries.
+
+        auto RangeList = std::vector<ParsedTopLevelRange>();
+        auto Begin = uint32_t();
+
+        const auto TargetSize = TokenCount / ThreadCount;
+        for (const auto Boundary : BoundaryList) {
+            if (Boundary - Begin < TargetSize) {
+                continue;
+            }
+
+            RangeList.emplace_back(Begin, Boundary);
+            Begin = Boundary;
+        }
+
+        if (Begin != TokenCount) {
+            RangeList.emplace_back(Begin, TokenCount);
+        }
+
+        if (RangeList.size() < 2) {
+            return false;
+        }
+
+        auto ThreadList = std::vector<std::thread>();
+        ThreadList.reserve(RangeList.size() - 1);
+
+        for (auto &Range : std::span(RangeList).subspan(1)) {
+            auto &Allocator = Unit.addWorkerAllocator();
+            ThreadList.emplace_back(
+                [&TokenBuffer, Options, &Range, &Allocator]() noexcept {
+                    const auto Scope =
+                        ADT::BumpAllocator::ThreadScope(Allocator);
+
+                    ParseTopLevelRangeInWorker(TokenBuffer, Options, Range);
+                });
+        }
+
+        ParseTopLevelRangeInWorker(TokenBuffer, Options, RangeList.front());
+        for (auto &Thread : ThreadList) {
+            Thread.join();
+        }
+
+        // Merge in source order. If a range's parser read past its end, the
+        // next range started mid-statement, so its result is thrown away and
+        // that part of the file is parsed again here.
+
+        auto TokenStream = Lex::TokenStream(TokenBuffer);
+        auto Context = ParseContext(TokenStream, Diag, Options);
+
+        auto Position = uint32_t();
+        for (const auto &Range : RangeList) {
+            if (Range.Begin != Position) {
+                TokenStream.goToPosition(Position);
+                if (!ParseTopLevelStmtRange(Context, Unit, Range.End)) {
+                    return true;
+                }
+
+                Position = TokenStream.position();
+                continue;
+            }
+
+            auto DiagMessageBegin = size_t();
+            for (const auto &Parsed : Range.StmtList) {
+                Range.Diag.replay(Diag, DiagMessageBegin,
+                                  Parsed.DiagMessageEnd);
+
+                AddTopLevelStmt(Unit, Parsed.Stmt, Parsed.Range, Diag);
+                DiagMessageBegin = Parsed.DiagMessageEnd;
+            }
+
+            Range.Diag.replay(Diag, DiagMessageBegin,
+                              Range.Diag.messageCount());
+
+            if (Range.CouldNotProceed) {
+                return true;
+            }
+
+            Position = Range.StoppedAt;
+        }
+
+        return true;
+    }
+
     auto
     ParseUnit::Create(const Lex::TokenBuffer &TokenBuffer,
                       DiagnosticConsumer &Diag,
                       const ParseOptions Options) noexcept -> ParseUnit
     {
+        auto Unit = ParseUnit();
+        if (Options.ParseTopLevelInParallel) {
+            if (ParseInParallel(TokenBuffer, Diag, Options, Unit)) {
+                return Unit;
+            }
+        }
+
         auto TokenStream = Lex::TokenStream(TokenBuffer);
         auto Context = ParseContext(TokenStream, Diag, Options);
+
+        ParseTopLevelStmtRange(
+            Context, Unit,
+            static_cast<uint32_t>(TokenBuffer.getTokenList().size()));
+        return Unit;
+    }
+
+    auto
+    ParseUnit::CreateByEditing(ParseUnit &&Old,
+                               const Lex::TokenBuffer &TokenBuffer,
+                               const Lex::TokenEdit &Edit,
+                               DiagnosticConsumer &Diag,
+                               const ParseOptions Options) noexcept
+        -> ParseUnit
+    {
         auto Unit = ParseUnit();
 
+        // Statements kept from Old may have been parsed on a worker thread.
+        Unit.WorkerAllocatorList = std::move(Old.WorkerAllocatorList);
+
+        auto TokenStream = Lex::TokenStream(TokenBuffer);
+        auto Context = ParseContext(TokenStream, Diag, Options);
+
+        const auto OldStmtList = Old.getTopLevelStmtList();
+        const auto OldRangeList = Old.getTopLevelStmtRangeList();
+        const auto OldStmtCount = OldStmtList.size();
+
+        // Statements that end before the relexed tokens are kept as is. The
+        // diagnostics emitted while parsing them are not repeated, except for
+        // reused decl names, which are found again when they're added.
+
+        auto I = size_t();
+        for (; I != OldStmtCount && OldRangeList[I].End < Edit.Begin; I++) {
+            AddTopLevelStmt(Unit, OldStmtList[I], OldRangeList[I], Diag);
+        }
+
+        if (I != 0) {
+            TokenStream.goToPosition(OldRangeList[I - 1].End);
+        }
+
+        // Statements that start after the relexed tokens are kept too, once
+        // parsing gets back to the start of one of them, as their tokens only
+        // moved.
+
+        const auto TokenDelta = int64_t(Edit.NewEnd) - int64_t(Edit.OldEnd);
+        const auto MovedBegin = [&](const size_t Index) noexcept {
+            return int64_t(OldRangeList[Index].Begin) + TokenDelta;
+        };
+
+        while (I != OldStmtCount && OldRangeList[I].Begin < Edit.OldEnd) {
+            I++;
+        }
+
         while (!TokenStream.reachedEof()) {
-            const auto StmtOpt = ParseStmt(Context);
-            if (!StmtOpt.has_value()) {
-                break;
+            const auto Begin = TokenStream.position();
+            while (I != OldStmtCount && MovedBegin(I) < Begin) {
+                I++;
             }
 
-            const auto Stmt = StmtOpt.value();
-            if (Stmt == nullptr) {
-                continue;
+            if (I != OldStmtCount && MovedBegin(I) == Begin) {
+                break;
             }
 
-            if (!Options.IgnoreUnusedExpressions) {
-                if (const auto Expr = llvm::dyn_cast<AST::Expr>(Stmt)){
-                    const auto BinOp =
-                        llvm::dyn_cast<AST::BinaryOperation>(Stmt);
-
-                    if (BinOp == nullptr || !BinOp->isAssignmentOperation()) {
-                        Diag.consume({
-                            .Level = DiagnosticLevel::Warning,
-                            .Location = Expr->getLoc(),
-                            .Message = "Expression result unused"
-                        });
-                    }
-                }
+            const auto StmtOpt = ParseTopLevelStmt(Context);
+            if (!StmtOpt.has_value()) {
+                return Unit;
             }
 
-            // All top level statements need ending semicolons, except top level
-            // functions and if-statements.
-
-            if (!llvm::isa<AST::FunctionDecl>(Stmt) &&
-                !llvm::isa<AST::IfExpr>(Stmt))
-            {
-                if (!ExpectSemicolon(Context)) {
-                    Diag.consume({
-                        .Level = DiagnosticLevel::Error,
-                        .Location = TokenStream.getCurrentOrPreviousLocation(),
-                        .Message = "Expected a semicolon after declaration"
-                    });
-                }
+            if (const auto Stmt = StmtOpt.value()) {
+                AddTopLevelStmt(Unit, Stmt, {
+                    .Begin = Begin,
+                    .End = TokenStream.position()
+                }, Diag);
             }
+        }
 
-            if (const auto Error = Unit.addTopLevelStmt(Stmt)) {
-                // TODO:
-                // Use ranges::join_with when it is available in llvm's libc++.
+        if (TokenStream.reachedEof()) {
+            return Unit;
+        }
 
-                Diag.consume({
-                    .Level = DiagnosticLevel::Error,
-                    .Location = Error.DeclNameList.front().Loc,
-                    .Message =
-                        std::format("Decl name '{}' is reused",
-                                    Error.DeclNameList.front().Name)
-                });
+        const auto ShiftLocs = Edit.Shift.Index != 0 || Edit.Shift.Row != 0;
+        for (; I != OldStmtCount; I++) {
+            if (ShiftLocs) {
+                AST::ShiftLocations(*OldStmtList[I], Edit.Shift);
             }
+
+            const auto Range = OldRangeList[I];
+            AddTopLevelStmt(Unit, OldStmtList[I], {
+                .Begin = static_cast<uint32_t>(Range.Begin + TokenDelta),
+                .End = static_cast<uint32_t>(Range.End + TokenDelta)
+            }, Diag);
         }
 
+        // Old may have stopped early on a statement it couldn't parse, so
+        // continue after its last statement.
+
+        TokenStream.goToPosition(Unit.TopLevelStmtRangeList.back().End);
+        ParseTopLevelStmtRange(
+            Context, Unit,
+            static_cast<uint32_t>(TokenBuffer.getTokenList().size()));
+
         return Unit;
     }
 }
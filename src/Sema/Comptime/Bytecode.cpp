@@ -0,0 +1,263 @@
+/*
+ * Sema/Comptime/Bytecode.cpp
+ * © suhas pai
+ */
+
+#include <cmath>
+
+#include "Sema/Comptime/Bytecode.h"
+
+namespace Sema::Comptime {
+    [[nodiscard]] static auto
+    ApplyFloatingPointOpcode(const Opcode Op,
+                             const BuiltinType &Type,
+                             const double Left,
+                             const double Right) noexcept
+        -> std::expected<Value, std::string_view>
+    {
+        switch (Op) {
+            case Opcode::Add:
+                return Value::FloatingPoint(Type, Left + Right);
+            case Opcode::Subtract:
+                return Value::FloatingPoint(Type, Left - Right);
+            case Opcode::Multiply:
+                return Value::FloatingPoint(Type, Left * Right);
+            case Opcode::Divide:
+                return Value::FloatingPoint(Type, Left / Right);
+            case Opcode::Modulo:
+                return Value::FloatingPoint(Type, std::fmod(Left, Right));
+            case Opcode::Power:
+                return Value::FloatingPoint(Type, std::pow(Left, Right));
+            case Opcode::LessThan:
+                return Value::Bool(Left < Right);
+            case Opcode::GreaterThan:
+                return Value::Bool(Left > Right);
+            case Opcode::LessThanOrEqual:
+                return Value::Bool(Left <= Right);
+            case Opcode::GreaterThanOrEqual:
+                return Value::Bool(Left >= Right);
+            case Opcode::Equality:
+                return Value::Bool(Left == Right);
+            case Opcode::Inequality:
+                return Value::Bool(Left != Right);
+            case Opcode::BitwiseAnd:
+            case Opcode::BitwiseOr:
+            case Opcode::BitwiseXor:
+            case Opcode::LeftShift:
+            case Opcode::RightShift:
+                return std::unexpected("Bitwise operator needs integer "
+                                       "operands");
+            default:
+                __builtin_unreachable();
+        }
+    }
+
+    auto
+    ApplyBinaryOpcode(const Opcode Op,
+                      const BuiltinType &Type,
+                      const Value Left,
+                      const Value Right) noexcept
+        -> std::expected<Value, std::string_view>
+    {
+        if (Type.isFloatingPoint()) {
+            return ApplyFloatingPointOpcode(Op, Type, Left.asFloat(),
+                                            Right.asFloat());
+        }
+
+        const auto IsSigned = Type.isSignedInteger();
+        const auto L = Left.asUInt();
+        const auto R = Right.asUInt();
+
+        switch (Op) {
+            case Opcode::Add:
+                return Value::Integer(Type, L + R);
+            case Opcode::Subtract:
+                return Value::Integer(Type, L - R);
+            case Opcode::Multiply:
+                return Value::Integer(Type, L * R);
+            case Opcode::Divide:
+            case Opcode::Modulo:
+                if (R == 0) {
+                    return std::unexpected("Division by zero");
+                }
+
+                if (!IsSigned) {
+                    return Value::Integer(Type,
+                                          Op == Opcode::Divide ? L / R : L % R);
+                }
+
+                // Dividing the smallest value by -1 overflows, so it's done
+                // by negating.
+
+                if (Right.asSInt() == -1) {
+                    return Value::Integer(Type,
+                                          Op == Opcode::Divide ? 0 - L : 0);
+                }
+
+                if (Op == Opcode::Divide) {
+                    return Value::Integer(Type,
+                                          static_cast<uint64_t>(
+                                            Left.asSInt() / Right.asSInt()));
+                }
+
+                return Value::Integer(Type,
+                                      static_cast<uint64_t>(
+                                        Left.asSInt() % Right.asSInt()));
+            case Opcode::Power: {
+                const auto Result =
+                    std::pow(IsSigned ? static_cast<double>(Left.asSInt()) :
+                                        static_cast<double>(L),
+                             IsSigned ? static_cast<double>(Right.asSInt()) :
+                                        static_cast<double>(R));
+
+                return ConvertValue(
+                    Value::FloatingPoint(BuiltinType::f64(), Result), Type);
+            }
+            case Opcode::BitwiseAnd:
+                return Value::Integer(Type, L & R);
+            case Opcode::BitwiseOr:
+                return Value::Integer(Type, L | R);
+            case Opcode::BitwiseXor:
+                return Value::Integer(Type, L ^ R);
+            case Opcode::LeftShift:
+            case Opcode::RightShift:
+                if (R >= Type.getBitWidth()) {
+                    return std::unexpected("Shift amount is too large for "
+                                           "the type");
+                }
+
+                if (Op == Opcode::LeftShift) {
+                    return Value::Integer(Type, L << R);
+                }
+
+                if (IsSigned) {
+                    return Value::Integer(Type,
+                                          static_cast<uint64_t>(
+                                            Left.asSInt() >> R));
+                }
+
+                return Value::Integer(Type, L >> R);
+            case Opcode::LessThan:
+                return Value::Bool(IsSigned ? Left.asSInt() < Right.asSInt() :
+                                              L < R);
+            case Opcode::GreaterThan:
+                return Value::Bool(IsSigned ? Left.asSInt() > Right.asSInt() :
+                                              L > R);
+            case Opcode::LessThanOrEqual:
+                return Value::Bool(IsSigned ? Left.asSInt() <= Right.asSInt() :
+                                              L <= R);
+            case Opcode::GreaterThanOrEqual:
+                return Value::Bool(IsSigned ? Left.asSInt() >= Right.asSInt() :
+                                              L >= R);
+            case Opcode::Equality:
+                return Value::Bool(L == R);
+            case Opcode::Inequality:
+                return Value::Bool(L != R);
+            default:
+                __builtin_unreachable();
+        }
+    }
+
+    auto
+    ApplyUnaryOpcode(const Opcode Op,
+                     const BuiltinType &Type,
+                     const Value Operand) noexcept
+        -> std::expected<Value, std::string_view>
+    {
+        switch (Op) {
+            case Opcode::Negate:
+                if (Type.isFloatingPoint()) {
+                    return Value::FloatingPoint(Type, -Operand.asFloat());
+                }
+
+                return Value::Integer(Type, 0 - Operand.asUInt());
+            case Opcode::BitwiseNot:
+                if (Type.isFloatingPoint()) {
+                    return std::unexpected("Bitwise operator needs an integer "
+                                           "operand");
+                }
+
+                return Value::Integer(Type, ~Operand.asUInt());
+            case Opcode::LogicalNot:
+                return Value::Bool(!Operand.isTrue());
+            default:
+                __builtin_unreachable();
+        }
+    }
+
+    // Converting a floating-point value that's out of range for an integer
+    // type is undefined in C++, so the value is clamped to the range of To
+    // first, and NaN is converted to zero.
+
+    [[nodiscard]] static auto
+    ConvertFloatingPointToInteger(const double Float,
+                                  const BuiltinType &To) noexcept
+    {
+        if (std::isnan(Float)) {
+            return Value::Integer(To, 0);
+        }
+
+        const auto BitWidth = static_cast<int>(To.getBitWidth());
+        if (To.isSignedInteger()) {
+            const auto Limit = std::ldexp(1.0, BitWidth - 1);
+            if (Float <= -Limit) {
+                return Value::Integer(To, uint64_t(1) << (BitWidth - 1));
+            }
+
+            if (Float >= Limit) {
+                return Value::Integer(To, (uint64_t(1) << (BitWidth - 1)) - 1);
+            }
+
+            return Value::Integer(To,
+                                  static_cast<uint64_t>(
+                                    static_cast<int64_t>(Float)));
+        }
+
+        if (Float <= 0) {
+            return Value::Integer(To, 0);
+        }
+
+        if (Float >= std::ldexp(1.0, BitWidth)) {
+            return Value::Integer(To, UINT64_MAX);
+        }
+
+        return Value::Integer(To, static_cast<uint64_t>(Float));
+    }
+
+    auto ConvertValue(const Value Operand, const BuiltinType &To) noexcept
+        -> Value
+    {
+        const auto &From = Operand.getType();
+        if (&From == &To) {
+            return Operand;
+        }
+
+        if (To.isVoid()) {
+            return Value();
+        }
+
+        if (To.isBool()) {
+            return Value::Bool(Operand.isTrue());
+        }
+
+        if (From.isFloatingPoint()) {
+            if (To.isFloatingPoint()) {
+                return Value::FloatingPoint(To, Operand.asFloat());
+            }
+
+            return ConvertFloatingPointToInteger(Operand.asFloat(), To);
+        }
+
+        if (To.isFloatingPoint()) {
+            return Value::FloatingPoint(
+                To,
+                From.isSignedInteger() ?
+                    static_cast<double>(Operand.asSInt()) :
+                    static_cast<double>(Operand.asUInt()));
+        }
+
+        // Signed values are kept sign-extended, and others zero-extended, so
+        // only the bits above the new width have to be dropped.
+        return Value::Integer(To, Operand.asUInt());
+    }
+}
@@ -0,0 +1,1307 @@
+/*
+ * Sema/Comptime/Compiler.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <format>
+#include <optional>
+
+#include "AST/BinaryOperation.h"
+#include "AST/CallExpr.h"
+#include "AST/CastExpr.h"
+#include "AST/CharLiteral.h"
+#include "AST/CommaSepStmtList.h"
+#include "AST/CompoundStmt.h"
+#include "AST/DeclRefExpr.h"
+#include "AST/Decls/VarDecl.h"
+#include "AST/ForStmt.h"
+#include "AST/IfExpr.h"
+#include "AST/NumberLiteral.h"
+#include "AST/ParenExpr.h"
+#include "AST/ReturnStmt.h"
+#include "AST/UnaryOperation.h"
+
+#include "llvm/Support/Casting.h"
+
+#include "Sema/Comptime/Compiler.h"
+#include "Sema/Comptime/Evaluator.h"
+#include "Sema/Comptime/TypeRules.h"
+
+namespace Sema::Comptime {
+    // What an expression was compiled to: a constant, if its value is known
+    // while compiling, or else the register that holds it once it runs.
+    struct Operand {
+        const BuiltinType *Type;
+        std::optional<Value> Constant = std::nullopt;
+        uint32_t Register = NoRegister;
+    };
+
+    static auto IsBitwiseOpcode(const Opcode Op) noexcept {
+        switch (Op) {
+            case Opcode::BitwiseAnd:
+            case Opcode::BitwiseOr:
+            case Opcode::BitwiseXor:
+            case Opcode::LeftShift:
+            case Opcode::RightShift:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static auto IsComparisonOpcode(const Opcode Op) noexcept {
+        switch (Op) {
+            case Opcode::LessThan:
+            case Opcode::GreaterThan:
+            case Opcode::LessThanOrEqual:
+            case Opcode::GreaterThanOrEqual:
+            case Opcode::Equality:
+            case Opcode::Inequality:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    struct FunctionCompiler {
+    protected:
+        Evaluator &Eval;
+        DiagnosticConsumer &Diag;
+        Function &Func;
+
+        // Type of each local slot, set once its declaration is compiled.
+        std::vector<const BuiltinType *> SlotTypeList;
+
+        // Registers below this hold locals or temporaries still in use.
+        uint32_t NextRegister = 0;
+
+        void report(const SourceLocation Loc, std::string &&Message) noexcept {
+            this->Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Loc,
+                .Message = std::move(Message)
+            });
+        }
+
+        auto cannotEvaluate(const AST::Stmt &Stmt) noexcept -> std::nullopt_t {
+            this->report(Stmt.getLoc(),
+                         "Expression can't be evaluated at compile time yet");
+
+            return std::nullopt;
+        }
+
+        auto
+        emit(const Opcode Op,
+             const BuiltinType *const Type,
+             const uint32_t A,
+             const uint32_t B,
+             const uint32_t C,
+             const SourceLocation Loc) noexcept -> size_t
+        {
+            this->Func.Code.push_back(Instruction {
+                .Op = Op,
+                .Type = Type,
+                .A = A,
+                .B = B,
+                .C = C
+            });
+
+            this->Func.LocationList.push_back(Loc);
+            return this->Func.Code.size() - 1;
+        }
+
+        // Points the jump at Index to the next instruction emitted.
+        void patchJump(const size_t Index) noexcept {
+            this->Func.Code[Index].B =
+                static_cast<uint32_t>(this->Func.Code.size());
+        }
+
+        auto allocRegister() noexcept -> uint32_t {
+            const auto Result = this->NextRegister++;
+            this->Func.RegisterCount =
+                std::max(this->Func.RegisterCount, this->NextRegister);
+
+            return Result;
+        }
+
+        auto addConstant(const Value Constant) noexcept -> uint32_t {
+            auto &ConstantList = this->Func.ConstantList;
+            const auto Iter = std::ranges::find(ConstantList, Constant);
+
+            if (Iter != ConstantList.end()) {
+                return static_cast<uint32_t>(Iter - ConstantList.begin());
+            }
+
+            ConstantList.push_back(Constant);
+            return static_cast<uint32_t>(ConstantList.size() - 1);
+        }
+
+        auto addCallee(Function &Callee) noexcept -> uint32_t {
+            auto &CalleeList = this->Func.CalleeList;
+            const auto Iter = std::ranges::find(CalleeList, &Callee);
+
+            if (Iter != CalleeList.end()) {
+                return static_cast<uint32_t>(Iter - CalleeList.begin());
+            }
+
+            CalleeList.push_back(&Callee);
+            return static_cast<uint32_t>(CalleeList.size() - 1);
+        }
+
+        auto
+        toRegister(const Operand &Operand, const SourceLocation Loc) noexcept
+            -> uint32_t
+        {
+            if (!Operand.Constant.has_value()) {
+                return Operand.Register;
+            }
+
+            const auto Result = this->allocRegister();
+            this->emit(Opcode::LoadConstant, Operand.Type, Result,
+                       this->addConstant(Operand.Constant.value()), 0, Loc);
+
+            return Result;
+        }
+
+        void
+        moveInto(const Operand &Operand,
+                 const uint32_t Register,
+                 const SourceLocation Loc) noexcept
+        {
+            if (Operand.Constant.has_value()) {
+                this->emit(Opcode::LoadConstant, Operand.Type, Register,
+                           this->addConstant(Operand.Constant.value()), 0,
+                           Loc);
+            } else if (Operand.Register != Register) {
+                this->emit(Opcode::Move, Operand.Type, Register,
+                           Operand.Register, 0, Loc);
+            }
+        }
+
+        // Converts Operand, compiled from Expr, to type To. Unless the
+        // conversion was written out, a number literal that doesn't fit in
+        // To is an error.
+
+        auto
+        convert(const Operand &Operand,
+                const BuiltinType &To,
+                const AST::Expr &Expr,
+                const bool IsExplicit = false) noexcept
+            -> std::optional<Comptime::Operand>
+        {
+            if (Operand.Type == &To) {
+                return Operand;
+            }
+
+            if (Operand.Constant.has_value()) {
+                const auto &Constant = Operand.Constant.value();
+                const auto Result = ConvertValue(Constant, To);
+
+                if (!IsExplicit &&
+                    IsUntypedLiteral(Expr) &&
+                    To.isInteger() &&
+                    !Operand.Type->isFloatingPoint() &&
+                    ConvertValue(Result, *Operand.Type) != Constant)
+                {
+                    this->report(Expr.getLoc(),
+                                 std::format("Number literal doesn't fit in "
+                                             "type \"{}\"",
+                                             To.getName()));
+
+                    return std::nullopt;
+                }
+
+                return Comptime::Operand {
+                    .Type = &To,
+                    .Constant = Result
+                };
+            }
+
+            const auto Result = this->allocRegister();
+            this->emit(Opcode::Convert, &To, Result, Operand.Register, 0,
+                       Expr.getLoc());
+
+            return Comptime::Operand {
+                .Type = &To,
+                .Register = Result
+            };
+        }
+
+        auto
+        checkType(const BuiltinType &Type, const SourceLocation Loc) noexcept
+            -> bool
+        {
+            // Only floating-point types the host has are supported.
+            if (Type.isFloatingPoint() && Type.getBitWidth() < 32) {
+                this->report(Loc,
+                             std::format("Type \"{}\" is not yet supported at "
+                                         "compile time",
+                                         Type.getName()));
+
+                return false;
+            }
+
+            return true;
+        }
+
+        // Until Sema resolves types, a type expression is only understood
+        // when it names a builtin type. Without a type expression, a value
+        // is an f64, as in codegen.
+
+        auto resolveType(const AST::Expr *const TypeExpr) noexcept
+            -> const BuiltinType *
+        {
+            if (TypeExpr == nullptr) {
+                return &BuiltinType::f64();
+            }
+
+            if (const auto DeclRef =
+                    llvm::dyn_cast<AST::DeclRefExpr>(TypeExpr))
+            {
+                if (const auto Type =
+                        BuiltinType::forName(DeclRef->getName()))
+                {
+                    if (!this->checkType(*Type, TypeExpr->getLoc())) {
+                        return nullptr;
+                    }
+
+                    return Type;
+                }
+            }
+
+            this->report(TypeExpr->getLoc(),
+                         "Only builtin types are supported at compile time");
+
+            return nullptr;
+        }
+
+        // Returns the slot of the local Expr names, if it names one.
+        auto getLocalSlot(const AST::Expr &Expr) const noexcept
+            -> std::optional<uint32_t>
+        {
+            if (const auto ParenExpr = llvm::dyn_cast<AST::ParenExpr>(&Expr)) {
+                return this->getLocalSlot(*ParenExpr->getChildExpr());
+            }
+
+            const auto DeclRef = llvm::dyn_cast<AST::DeclRefExpr>(&Expr);
+            if (DeclRef == nullptr) {
+                return std::nullopt;
+            }
+
+            const auto Decl =
+                llvm::dyn_cast_if_present<AST::LvalueNamedDecl>(
+                    DeclRef->getDecl());
+
+            if (Decl == nullptr || !Decl->hasSlot()) {
+                return std::nullopt;
+            }
+
+            const auto Slot = Decl->getSlot();
+            if (Slot >= this->SlotTypeList.size() ||
+                this->SlotTypeList[Slot] == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            return Slot;
+        }
+
+        auto compileNumberLiteral(const AST::NumberLiteral &NumLit) noexcept
+            -> std::optional<Operand>
+        {
+            const auto &Number = NumLit.getNumber().Success;
+            auto Literal = Value();
+
+            switch (Number.Kind) {
+                case Lex::NumberKind::UnsignedInteger:
+                    // Only literals too large for an s64 are unsigned.
+                    Literal =
+                        Value::Integer(Number.UInt > INT64_MAX ?
+                                        BuiltinType::u64() :
+                                        BuiltinType::s64(),
+                                       Number.UInt);
+                    break;
+                case Lex::NumberKind::SignedInteger:
+                    Literal = Value::Integer(BuiltinType::s64(), Number.UInt);
+                    break;
+                case Lex::NumberKind::FloatingPoint:
+                    Literal =
+                        Value::FloatingPoint(BuiltinType::f64(),
+                                             Number.Float64);
+                    break;
+            }
+
+            const auto Type = BuiltinType::forName(Number.Suffix);
+            if (Type == nullptr) {
+                return Operand {
+                    .Type = &Literal.getType(),
+                    .Constant = Literal
+                };
+            }
+
+            if (!this->checkType(*Type, NumLit.getLoc())) {
+                return std::nullopt;
+            }
+
+            const auto Result = ConvertValue(Literal, *Type);
+            if (Number.Kind != Lex::NumberKind::FloatingPoint &&
+                !Type->isFloatingPoint() &&
+                ConvertValue(Result, Literal.getType()) != Literal)
+            {
+                this->report(NumLit.getLoc(),
+                             std::format("Number literal doesn't fit in type "
+                                         "\"{}\"",
+                                         Type->getName()));
+
+                return std::nullopt;
+            }
+
+            return Operand {
+                .Type = Type,
+                .Constant = Result
+            };
+        }
+
+        auto compileDeclRefExpr(const AST::DeclRefExpr &DeclRef) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Name = DeclRef.getName();
+            const auto Decl =
+                llvm::dyn_cast_if_present<AST::LvalueNamedDecl>(
+                    DeclRef.getDecl());
+
+            if (Decl == nullptr) {
+                if (DeclRef.getDecl() == nullptr &&
+                    BuiltinType::forName(Name) != nullptr)
+                {
+                    this->report(DeclRef.getNameLoc(),
+                                 "Types can't be used as values at compile "
+                                 "time yet");
+
+                    return std::nullopt;
+                }
+            } else if (const auto Slot = this->getLocalSlot(DeclRef)) {
+                return Operand {
+                    .Type = this->SlotTypeList[Slot.value()],
+                    .Register = Slot.value()
+                };
+            } else if (const auto VarDecl =
+                        llvm::dyn_cast<AST::VarDecl>(Decl);
+                       VarDecl != nullptr && !VarDecl->hasSlot())
+            {
+                const auto Result = this->Eval.evaluateDecl(*VarDecl);
+                if (!Result.has_value()) {
+                    return std::nullopt;
+                }
+
+                return Operand {
+                    .Type = &Result->getType(),
+                    .Constant = Result.value()
+                };
+            } else if (llvm::isa_and_nonnull<AST::FunctionDecl>(
+                        Decl->getRvalueExpr()))
+            {
+                this->report(DeclRef.getNameLoc(),
+                             "Functions can only be called at compile time, "
+                             "not used as values");
+
+                return std::nullopt;
+            }
+
+            this->report(DeclRef.getNameLoc(),
+                         std::format("\"{}\" can't be used at compile time",
+                                     Name));
+
+            return std::nullopt;
+        }
+
+        auto compileUnaryOperation(const AST::UnaryOperation &UnaryOp) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Loc = UnaryOp.getLoc();
+            auto Op = Opcode();
+
+            switch (UnaryOp.getOperator()) {
+                case Parse::UnaryOperator::Negate:
+                    Op = Opcode::Negate;
+                    break;
+                case Parse::UnaryOperator::BitwiseNot:
+                    Op = Opcode::BitwiseNot;
+                    break;
+                case Parse::UnaryOperator::LogicalNot:
+                    Op = Opcode::LogicalNot;
+                    break;
+                case Parse::UnaryOperator::Increment:
+                case Parse::UnaryOperator::Decrement:
+                    return this->compileIncrement(UnaryOp);
+                default:
+                    return this->cannotEvaluate(UnaryOp);
+            }
+
+            const auto OperandOpt = this->compileValue(UnaryOp.getOperand());
+            if (!OperandOpt.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto &Operand = OperandOpt.value();
+            const auto &Type = *Operand.Type;
+
+            const auto ResultType =
+                Op == Opcode::LogicalNot ? &BuiltinType::boolType() : &Type;
+
+            if (Operand.Constant.has_value()) {
+                const auto Result =
+                    ApplyUnaryOpcode(Op, Type, Operand.Constant.value());
+
+                if (!Result.has_value()) {
+                    this->report(Loc, std::string(Result.error()));
+                    return std::nullopt;
+                }
+
+                return Comptime::Operand {
+                    .Type = ResultType,
+                    .Constant = Result.value()
+                };
+            }
+
+            if (Op == Opcode::BitwiseNot && Type.isFloatingPoint()) {
+                this->report(Loc,
+                             std::format("Bitwise operator needs an integer "
+                                         "operand, not \"{}\"",
+                                         Type.getName()));
+
+                return std::nullopt;
+            }
+
+            const auto Result = this->allocRegister();
+            this->emit(Op, &Type, Result, Operand.Register, 0, Loc);
+
+            return Comptime::Operand {
+                .Type = ResultType,
+                .Register = Result
+            };
+        }
+
+        // Prefix increments and decrements update the local they're
+        // applied to.
+
+        auto compileIncrement(const AST::UnaryOperation &UnaryOp) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Loc = UnaryOp.getLoc();
+            const auto Slot = this->getLocalSlot(UnaryOp.getOperand());
+
+            if (!Slot.has_value()) {
+                this->report(Loc,
+                             "Only locals can be changed at compile time");
+
+                return std::nullopt;
+            }
+
+            const auto &Type = *this->SlotTypeList[Slot.value()];
+            const auto One =
+                Type.isFloatingPoint() ?
+                    Value::FloatingPoint(Type, 1) : Value::Integer(Type, 1);
+
+            const auto OneRegister =
+                this->toRegister(Operand { .Type = &Type, .Constant = One },
+                                 Loc);
+
+            const auto Op =
+                UnaryOp.getOperator() == Parse::UnaryOperator::Increment ?
+                    Opcode::Add : Opcode::Subtract;
+
+            this->emit(Op, &Type, Slot.value(), Slot.value(), OneRegister,
+                       Loc);
+
+            return Operand {
+                .Type = &Type,
+                .Register = Slot.value()
+            };
+        }
+
+        // Applies Op to Left and Right, which must both be of type Type.
+        auto
+        applyBinaryOpcode(const Opcode Op,
+                          const BuiltinType &Type,
+                          const Operand &Left,
+                          const Operand &Right,
+                          const SourceLocation Loc) noexcept
+            -> std::optional<Operand>
+        {
+            if (IsBitwiseOpcode(Op) && Type.isFloatingPoint()) {
+                this->report(Loc,
+                             std::format("Bitwise operator needs integer "
+                                         "operands, not \"{}\"",
+                                         Type.getName()));
+
+                return std::nullopt;
+            }
+
+            const auto ResultType =
+                IsComparisonOpcode(Op) ? &BuiltinType::boolType() : &Type;
+
+            if (Left.Constant.has_value() && Right.Constant.has_value()) {
+                const auto Result =
+                    ApplyBinaryOpcode(Op,
+                                      Type,
+                                      Left.Constant.value(),
+                                      Right.Constant.value());
+
+                if (!Result.has_value()) {
+                    this->report(Loc, std::string(Result.error()));
+                    return std::nullopt;
+                }
+
+                return Operand {
+                    .Type = ResultType,
+                    .Constant = Result.value()
+                };
+            }
+
+            const auto LeftRegister = this->toRegister(Left, Loc);
+            const auto RightRegister = this->toRegister(Right, Loc);
+            const auto Result = this->allocRegister();
+
+            this->emit(Op, &Type, Result, LeftRegister, RightRegister, Loc);
+            return Operand {
+                .Type = ResultType,
+                .Register = Result
+            };
+        }
+
+        auto compileBinaryOperation(const AST::BinaryOperation &BinOp) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Oper = BinOp.getOperator();
+            if (BinOp.isAssignmentOperation()) {
+                return this->compileAssignment(BinOp);
+            }
+
+            if (Oper == Parse::BinaryOperator::LogicalAnd ||
+                Oper == Parse::BinaryOperator::LogicalOr)
+            {
+                return this->compileLogicalOperation(BinOp);
+            }
+
+            const auto Op = BinaryOperatorToOpcode(Oper);
+            if (!Op.has_value()) {
+                return this->cannotEvaluate(BinOp);
+            }
+
+            const auto LeftOpt = this->compileValue(BinOp.getLhs());
+            if (!LeftOpt.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto RightOpt = this->compileValue(BinOp.getRhs());
+            if (!RightOpt.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto &Type =
+                GetOperandType(BinOp, *LeftOpt->Type, *RightOpt->Type);
+
+            const auto Left =
+                this->convert(LeftOpt.value(), Type, BinOp.getLhs());
+            const auto Right =
+                this->convert(RightOpt.value(), Type, BinOp.getRhs());
+
+            if (!Left.has_value() || !Right.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->applyBinaryOpcode(Op.value(), Type, Left.value(),
+                                           Right.value(), BinOp.getLoc());
+        }
+
+        // The right operand of && and || only runs if the left one doesn't
+        // decide the result.
+
+        auto
+        compileLogicalOperation(const AST::BinaryOperation &BinOp) noexcept
+            -> std::optional<Operand>
+        {
+            const auto IsAnd =
+                BinOp.getOperator() == Parse::BinaryOperator::LogicalAnd;
+
+            const auto Loc = BinOp.getLoc();
+            const auto Left = this->compileCondition(BinOp.getLhs());
+
+            if (!Left.has_value()) {
+                return std::nullopt;
+            }
+
+            if (Left->Constant.has_value()) {
+                if (Left->Constant->isTrue() != IsAnd) {
+                    return Left;
+                }
+
+                return this->compileCondition(BinOp.getRhs());
+            }
+
+            const auto Result = this->allocRegister();
+            this->moveInto(Left.value(), Result, Loc);
+
+            const auto Jump =
+                this->emit(IsAnd ? Opcode::JumpIfFalse : Opcode::JumpIfTrue,
+                           &BuiltinType::boolType(), Result, 0, 0, Loc);
+
+            const auto Right = this->compileCondition(BinOp.getRhs());
+            if (!Right.has_value()) {
+                return std::nullopt;
+            }
+
+            this->moveInto(Right.value(), Result, Loc);
+            this->patchJump(Jump);
+
+            return Operand {
+                .Type = &BuiltinType::boolType(),
+                .Register = Result
+            };
+        }
+
+        auto compileAssignment(const AST::BinaryOperation &BinOp) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Loc = BinOp.getLoc();
+            const auto Slot = this->getLocalSlot(BinOp.getLhs());
+
+            if (!Slot.has_value()) {
+                this->report(Loc,
+                             "Only locals can be changed at compile time");
+
+                return std::nullopt;
+            }
+
+            const auto &Type = *this->SlotTypeList[Slot.value()];
+            const auto RightOpt = this->compileValue(BinOp.getRhs());
+
+            if (!RightOpt.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto Local = Operand {
+                .Type = &Type,
+                .Register = Slot.value()
+            };
+
+            auto Result = std::optional<Operand>();
+            if (BinOp.getOperator() == Parse::BinaryOperator::Assignment) {
+                Result = this->convert(RightOpt.value(), Type, BinOp.getRhs());
+            } else {
+                const auto Op = BinaryOperatorToOpcode(BinOp.getOperator());
+                if (!Op.has_value()) {
+                    return this->cannotEvaluate(BinOp);
+                }
+
+                const auto &OperandType =
+                    GetOperandType(BinOp, Type, *RightOpt->Type);
+
+                const auto Left =
+                    this->convert(Local, OperandType, BinOp.getLhs());
+                const auto Right =
+                    this->convert(RightOpt.value(), OperandType,
+                                  BinOp.getRhs());
+
+                if (!Left.has_value() || !Right.has_value()) {
+                    return std::nullopt;
+                }
+
+                const auto Computed =
+                    this->applyBinaryOpcode(Op.value(), OperandType,
+                                            Left.value(), Right.value(), Loc);
+
+                if (!Computed.has_value()) {
+                    return std::nullopt;
+                }
+
+                Result = this->convert(Computed.value(), Type, BinOp,
+                                       /*IsExplicit=*/true);
+            }
+
+            if (!Result.has_value()) {
+                return std::nullopt;
+            }
+
+            this->moveInto(Result.value(), Slot.value(), Loc);
+            return Local;
+        }
+
+        auto compileCastExpr(const AST::CastExpr &Cast) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Type = this->resolveType(Cast.getTypeExpr());
+            if (Type == nullptr) {
+                return std::nullopt;
+            }
+
+            const auto Operand = this->compileValue(*Cast.getOperand());
+            if (!Operand.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->convert(Operand.value(), *Type, *Cast.getOperand(),
+                                 /*IsExplicit=*/true);
+        }
+
+        // Only top-level functions can be called, as a nested function could
+        // read the locals of the function around it.
+
+        auto compileCallExpr(const AST::CallExpr &Call) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Loc = Call.getParenLoc();
+            const auto DeclRef =
+                llvm::dyn_cast<AST::DeclRefExpr>(Call.getCalleeExpr());
+
+            const auto Decl =
+                DeclRef != nullptr ?
+                    llvm::dyn_cast_if_present<AST::LvalueNamedDecl>(
+                        DeclRef->getDecl()) :
+                    nullptr;
+
+            const auto FuncDecl =
+                Decl != nullptr && !Decl->hasSlot() ?
+                    llvm::dyn_cast_if_present<AST::FunctionDecl>(
+                        Decl->getRvalueExpr()) :
+                    nullptr;
+
+            if (FuncDecl == nullptr) {
+                this->report(Loc,
+                             "Only top-level functions can be called at "
+                             "compile time");
+
+                return std::nullopt;
+            }
+
+            const auto Callee = this->Eval.getFunction(*FuncDecl);
+            if (Callee == nullptr) {
+                return std::nullopt;
+            }
+
+            const auto ArgList = Call.getArgumentList();
+            const auto &ParamTypeList = Callee->ParamTypeList;
+
+            if (ArgList.size() != ParamTypeList.size()) {
+                this->report(Loc,
+                             std::format("{} arguments provided to function "
+                                         "\"{}\", expected {}",
+                                         ArgList.size(),
+                                         Decl->getName(),
+                                         ParamTypeList.size()));
+
+                return std::nullopt;
+            }
+
+            if (Callee->ReturnType == nullptr) {
+                this->report(Loc,
+                             std::format("Function \"{}\" must write out its "
+                                         "return type to call itself at "
+                                         "compile time",
+                                         Decl->getName()));
+
+                return std::nullopt;
+            }
+
+            // Arguments are passed in consecutive registers.
+            const auto FirstArg = this->NextRegister;
+            for (auto I = size_t(); I != ArgList.size(); I++) {
+                this->allocRegister();
+            }
+
+            for (auto I = size_t(); I != ArgList.size(); I++) {
+                const auto &Arg = ArgList[I];
+                if (Arg.Label.has_value()) {
+                    this->report(Arg.Expr->getLoc(),
+                                 "Labeled arguments aren't supported at "
+                                 "compile time yet");
+
+                    return std::nullopt;
+                }
+
+                const auto ArgValue = this->compileValue(*Arg.Expr);
+                if (!ArgValue.has_value()) {
+                    return std::nullopt;
+                }
+
+                const auto Converted =
+                    this->convert(ArgValue.value(), *ParamTypeList[I],
+                                  *Arg.Expr);
+
+                if (!Converted.has_value()) {
+                    return std::nullopt;
+                }
+
+                this->moveInto(Converted.value(),
+                               FirstArg + static_cast<uint32_t>(I),
+                               Arg.Expr->getLoc());
+            }
+
+            const auto Result = this->allocRegister();
+            this->emit(Opcode::Call, Callee->ReturnType, Result,
+                       this->addCallee(*Callee), FirstArg, Loc);
+
+            return Operand {
+                .Type = Callee->ReturnType,
+                .Register = Result
+            };
+        }
+
+        auto compileExpr(const AST::Expr &Expr) noexcept
+            -> std::optional<Operand>
+        {
+            if (const auto NumLit = llvm::dyn_cast<AST::NumberLiteral>(&Expr)) {
+                return this->compileNumberLiteral(*NumLit);
+            }
+
+            if (const auto CharLit = llvm::dyn_cast<AST::CharLiteral>(&Expr)) {
+                return Operand {
+                    .Type = &BuiltinType::u8(),
+                    .Constant =
+                        Value::Integer(BuiltinType::u8(),
+                                       static_cast<uint8_t>(
+                                        CharLit->getValue()))
+                };
+            }
+
+            if (const auto ParenExpr = llvm::dyn_cast<AST::ParenExpr>(&Expr)) {
+                return this->compileExpr(*ParenExpr->getChildExpr());
+            }
+
+            if (const auto DeclRef = llvm::dyn_cast<AST::DeclRefExpr>(&Expr)) {
+                return this->compileDeclRefExpr(*DeclRef);
+            }
+
+            if (const auto UnaryOp =
+                    llvm::dyn_cast<AST::UnaryOperation>(&Expr))
+            {
+                return this->compileUnaryOperation(*UnaryOp);
+            }
+
+            if (const auto BinOp =
+                    llvm::dyn_cast<AST::BinaryOperation>(&Expr))
+            {
+                return this->compileBinaryOperation(*BinOp);
+            }
+
+            if (const auto Cast = llvm::dyn_cast<AST::CastExpr>(&Expr)) {
+                return this->compileCastExpr(*Cast);
+            }
+
+            if (const auto Call = llvm::dyn_cast<AST::CallExpr>(&Expr)) {
+                return this->compileCallExpr(*Call);
+            }
+
+            return this->cannotEvaluate(Expr);
+        }
+
+        // Compiles an expression whose value is used.
+        auto compileValue(const AST::Expr &Expr) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Result = this->compileExpr(Expr);
+            if (Result.has_value() && Result->Type->isVoid()) {
+                this->report(Expr.getLoc(), "Expression has no value");
+                return std::nullopt;
+            }
+
+            return Result;
+        }
+
+        auto compileCondition(const AST::Expr &Expr) noexcept
+            -> std::optional<Operand>
+        {
+            const auto Result = this->compileValue(Expr);
+            if (!Result.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->convert(Result.value(), BuiltinType::boolType(),
+                                 Expr);
+        }
+
+        auto compileVarDecl(const AST::VarDecl &Decl) noexcept -> bool {
+            if (!Decl.hasSlot()) {
+                this->cannotEvaluate(Decl);
+                return false;
+            }
+
+            auto Type = static_cast<const BuiltinType *>(nullptr);
+            if (!Decl.hasInferredType()) {
+                Type = this->resolveType(Decl.getTypeExpr());
+                if (Type == nullptr) {
+                    return false;
+                }
+            }
+
+            const auto Slot = Decl.getSlot();
+            const auto InitExpr = Decl.getInitExpr();
+
+            if (InitExpr == nullptr) {
+                if (Type == nullptr) {
+                    this->report(Decl.getNameLoc(),
+                                 std::format("\"{}\" needs a type or an "
+                                             "initial value",
+                                             Decl.getName()));
+
+                    return false;
+                }
+
+                this->moveInto(Operand {
+                                   .Type = Type,
+                                   .Constant = ConvertValue(Value(), *Type)
+                               },
+                               Slot,
+                               Decl.getNameLoc());
+            } else {
+                const auto Init = this->compileValue(*InitExpr);
+                if (!Init.has_value()) {
+                    return false;
+                }
+
+                if (Type == nullptr) {
+                    Type = Init->Type;
+                }
+
+                const auto Converted =
+                    this->convert(Init.value(), *Type, *InitExpr);
+
+                if (!Converted.has_value()) {
+                    return false;
+                }
+
+                this->moveInto(Converted.value(), Slot, Decl.getNameLoc());
+            }
+
+            this->SlotTypeList[Slot] = Type;
+            return true;
+        }
+
+        // A function that doesn't write out its return type returns the type
+        // of its first return statement.
+
+        auto compileReturnStmt(const AST::ReturnStmt &RetStmt) noexcept
+            -> bool
+        {
+            const auto Loc = RetStmt.getReturnLoc();
+            auto &ReturnType = this->Func.ReturnType;
+
+            if (RetStmt.getValue() == nullptr) {
+                if (ReturnType == nullptr) {
+                    ReturnType = &BuiltinType::voidType();
+                } else if (!ReturnType->isVoid()) {
+                    this->report(Loc,
+                                 std::format("Function must return a value "
+                                             "of type \"{}\"",
+                                             ReturnType->getName()));
+
+                    return false;
+                }
+
+                this->emit(Opcode::Return, ReturnType, NoRegister, 0, 0, Loc);
+                return true;
+            }
+
+            const auto &Expr = *RetStmt.getValue();
+            const auto Result = this->compileValue(Expr);
+
+            if (!Result.has_value()) {
+                return false;
+            }
+
+            if (ReturnType == nullptr) {
+                ReturnType = Result->Type;
+            } else if (ReturnType->isVoid()) {
+                this->report(Loc, "Function returning void returns a value");
+                return false;
+            }
+
+            const auto Converted =
+                this->convert(Result.value(), *ReturnType, Expr);
+
+            if (!Converted.has_value()) {
+                return false;
+            }
+
+            this->emit(Opcode::Return, ReturnType,
+                       this->toRegister(Converted.value(), Loc), 0, 0, Loc);
+
+            return true;
+        }
+
+        auto compileIfExpr(const AST::IfExpr &IfExpr) noexcept -> bool {
+            const auto Cond = this->compileCondition(*IfExpr.getCond());
+            if (!Cond.has_value()) {
+                return false;
+            }
+
+            const auto Then = IfExpr.getThen();
+            const auto Else = IfExpr.getElse();
+
+            if (Cond->Constant.has_value()) {
+                const auto Branch = Cond->Constant->isTrue() ? Then : Else;
+                return Branch == nullptr || this->compileStmt(*Branch);
+            }
+
+            const auto Loc = IfExpr.getIfLoc();
+            const auto JumpToElse =
+                this->emit(Opcode::JumpIfFalse, &BuiltinType::boolType(),
+                           Cond->Register, 0, 0, Loc);
+
+            if (!this->compileStmt(*Then)) {
+                return false;
+            }
+
+            if (Else == nullptr) {
+                this->patchJump(JumpToElse);
+                return true;
+            }
+
+            const auto JumpToEnd =
+                this->emit(Opcode::Jump, nullptr, 0, 0, 0, Loc);
+
+            this->patchJump(JumpToElse);
+            if (!this->compileStmt(*Else)) {
+                return false;
+            }
+
+            this->patchJump(JumpToEnd);
+            return true;
+        }
+
+        auto compileForStmt(const AST::ForStmt &ForStmt) noexcept -> bool {
+            const auto Loc = ForStmt.getForLoc();
+            if (const auto Init = ForStmt.getInit()) {
+                if (!this->compileStmt(*Init)) {
+                    return false;
+                }
+            }
+
+            const auto LoopStart = this->Func.Code.size();
+            auto JumpToEnd = std::optional<size_t>();
+
+            if (const auto CondExpr = ForStmt.getCond()) {
+                const auto Cond = this->compileCondition(*CondExpr);
+                if (!Cond.has_value()) {
+                    return false;
+                }
+
+                if (Cond->Constant.has_value()) {
+                    if (!Cond->Constant->isTrue()) {
+                        return true;
+                    }
+                } else {
+                    JumpToEnd =
+                        this->emit(Opcode::JumpIfFalse,
+                                   &BuiltinType::boolType(), Cond->Register,
+                                   0, 0, Loc);
+                }
+            }
+
+            if (const auto Body = ForStmt.getBody()) {
+                if (!this->compileStmt(*Body)) {
+                    return false;
+                }
+            }
+
+            if (const auto Step = ForStmt.getStep()) {
+                if (!this->compileStmt(*Step)) {
+                    return false;
+                }
+            }
+
+            this->emit(Opcode::Jump, nullptr, 0,
+                       static_cast<uint32_t>(LoopStart), 0, Loc);
+
+            if (JumpToEnd.has_value()) {
+                this->patchJump(JumpToEnd.value());
+            }
+
+            return true;
+        }
+
+        // Temporaries are only used within a statement, so their registers
+        // are given out again once it's compiled.
+
+        auto compileStmt(const AST::Stmt &Stmt) noexcept -> bool {
+            const auto FirstTemporary = this->NextRegister;
+            const auto Result = this->compileStmtInner(Stmt);
+
+            this->NextRegister = FirstTemporary;
+            return Result;
+        }
+
+        auto compileStmtInner(const AST::Stmt &Stmt) noexcept -> bool {
+            if (const auto VarDecl = llvm::dyn_cast<AST::VarDecl>(&Stmt)) {
+                return this->compileVarDecl(*VarDecl);
+            }
+
+            if (const auto RetStmt = llvm::dyn_cast<AST::ReturnStmt>(&Stmt)) {
+                return this->compileReturnStmt(*RetStmt);
+            }
+
+            if (const auto IfExpr = llvm::dyn_cast<AST::IfExpr>(&Stmt)) {
+                return this->compileIfExpr(*IfExpr);
+            }
+
+            if (const auto ForStmt = llvm::dyn_cast<AST::ForStmt>(&Stmt)) {
+                return this->compileForStmt(*ForStmt);
+            }
+
+            if (const auto Compound = llvm::dyn_cast<AST::CompoundStmt>(&Stmt))
+            {
+                for (const auto Child : Compound->getStmtList()) {
+                    if (!this->compileStmt(*Child)) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            if (const auto List = llvm::dyn_cast<AST::CommaSepStmtList>(&Stmt))
+            {
+                for (const auto Child : List->getStmtList()) {
+                    if (!this->compileStmt(*Child)) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            if (const auto Expr = llvm::dyn_cast<AST::Expr>(&Stmt)) {
+                return this->compileExpr(*Expr).has_value();
+            }
+
+            this->cannotEvaluate(Stmt);
+            return false;
+        }
+    public:
+        explicit
+        FunctionCompiler(Evaluator &Eval,
+                         Function &Func,
+                         const uint32_t SlotCount) noexcept
+        : Eval(Eval), Diag(Eval.getDiag()), Func(Func),
+          SlotTypeList(SlotCount), NextRegister(SlotCount)
+        {
+            Func.RegisterCount = SlotCount;
+        }
+
+        auto compileFunction() noexcept -> bool {
+            const auto &Decl = *this->Func.Decl;
+            const auto ParamList = Decl.getParamList();
+
+            for (auto I = size_t(); I != ParamList.size(); I++) {
+                const auto Param =
+                    llvm::dyn_cast<AST::LvalueTypedDecl>(ParamList[I]);
+
+                if (Param == nullptr || !Param->hasSlot()) {
+                    this->report(ParamList[I]->getLoc(),
+                                 "Only named parameters are supported at "
+                                 "compile time");
+
+                    return false;
+                }
+
+                // Parameters are declared before anything else in the
+                // function, so they're given the first slots.
+                assert(Param->getSlot() == I &&
+                       "Parameter doesn't have the slot of its index");
+
+                const auto Type = this->resolveType(Param->getTypeExpr());
+                if (Type == nullptr) {
+                    return false;
+                }
+
+                this->SlotTypeList[Param->getSlot()] = Type;
+                this->Func.ParamTypeList.push_back(Type);
+            }
+
+            if (const auto ReturnTypeExpr = Decl.getReturnTypeExpr()) {
+                this->Func.ReturnType = this->resolveType(ReturnTypeExpr);
+                if (this->Func.ReturnType == nullptr) {
+                    return false;
+                }
+            }
+
+            const auto Body = Decl.getBody();
+            if (Body == nullptr) {
+                this->report(Decl.getLoc(),
+                             "Function without a body can't be called at "
+                             "compile time");
+
+                return false;
+            }
+
+            if (!this->compileStmt(*Body)) {
+                return false;
+            }
+
+            // A function that never returns a value returns void. One that
+            // does fails at the end instead, when the end is reached.
+
+            if (this->Func.ReturnType == nullptr) {
+                this->Func.ReturnType = &BuiltinType::voidType();
+            }
+
+            this->emit(Opcode::Return, this->Func.ReturnType, NoRegister, 0,
+                       0, Decl.getLoc());
+
+            return true;
+        }
+
+        auto
+        compileThunk(const AST::Expr &Expr,
+                     const AST::Expr *const TypeExpr) noexcept -> bool
+        {
+            auto Type = static_cast<const BuiltinType *>(nullptr);
+            if (TypeExpr != nullptr) {
+                Type = this->resolveType(TypeExpr);
+                if (Type == nullptr) {
+                    return false;
+                }
+            }
+
+            auto Result = this->compileValue(Expr);
+            if (!Result.has_value()) {
+                return false;
+            }
+
+            if (Type != nullptr) {
+                Result = this->convert(Result.value(), *Type, Expr);
+                if (!Result.has_value()) {
+                    return false;
+                }
+            }
+
+            this->Func.ReturnType = Result->Type;
+            this->emit(Opcode::Return, Result->Type,
+                       this->toRegister(Result.value(), Expr.getLoc()), 0, 0,
+                       Expr.getLoc());
+
+            return true;
+        }
+    };
+
+    auto CompileFunction(Evaluator &Evaluator, Function &Func) noexcept -> bool
+    {
+        auto Compiler =
+            FunctionCompiler(Evaluator, Func, Func.Decl->getSlotCount());
+
+        return Compiler.compileFunction();
+    }
+
+    auto
+    CompileExpr(Evaluator &Evaluator,
+                const AST::Expr &Expr,
+                const AST::Expr *const TypeExpr,
+                Function &Func) noexcept -> bool
+    {
+        auto Compiler = FunctionCompiler(Evaluator, Func, /*SlotCount=*/0);
+        return Compiler.compileThunk(Expr, TypeExpr);
+    }
+}
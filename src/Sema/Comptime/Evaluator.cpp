@@ -0,0 +1,396 @@
+/*
+ * Sema/Comptime/Evaluator.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <format>
+
+#include "llvm/Support/Casting.h"
+
+#include "Sema/Comptime/Compiler.h"
+#include "Sema/Comptime/Evaluator.h"
+
+namespace Sema::Comptime {
+    // Compile-time code can loop forever, or recurse without end, so both
+    // are cut off.
+
+    constexpr static auto MaxStepCount = uint64_t(1) << 26;
+    constexpr static auto MaxCallDepth = 1024;
+
+    [[nodiscard]] static constexpr auto
+    HashCombine(const size_t Seed, const size_t Hash) noexcept -> size_t {
+        return Seed ^ (Hash + 0x9e3779b97f4a7c15 + (Seed << 6) + (Seed >> 2));
+    }
+
+    auto
+    Evaluator::CallKeyHash::operator()(const CallKeyRef &Key) const noexcept
+        -> size_t
+    {
+        auto Result = std::hash<const Function *>()(Key.Callee);
+        for (const auto &Arg : Key.ArgList) {
+            Result = HashCombine(Result, std::hash<Value>()(Arg));
+        }
+
+        return Result;
+    }
+
+    auto
+    Evaluator::CallKeyEqual::operator()(const CallKeyRef &Left,
+                                        const CallKeyRef &Right) const noexcept
+        -> bool
+    {
+        return Left.Callee == Right.Callee &&
+               std::ranges::equal(Left.ArgList, Right.ArgList);
+    }
+
+    auto
+    Evaluator::run(const Function &Func, const size_t Base) noexcept
+        -> std::optional<Value>
+    {
+        if (this->RegisterStack.size() < Base + Func.RegisterCount) {
+            this->RegisterStack.resize(Base + Func.RegisterCount);
+        }
+
+        auto Registers = this->RegisterStack.data() + Base;
+        const auto Fail =
+            [&](const size_t Index, const std::string_view Message) noexcept
+                -> std::optional<Value>
+            {
+                this->Diag.consume({
+                    .Level = DiagnosticLevel::Error,
+                    .Location = Func.LocationList[Index],
+                    .Message = std::string(Message)
+                });
+
+                return std::nullopt;
+            };
+
+        for (auto Index = size_t();;) {
+            if (this->StepsLeft == 0) {
+                return Fail(Index,
+                            "Compile-time evaluation took too many steps");
+            }
+
+            this->StepsLeft--;
+
+            const auto &Inst = Func.Code[Index++];
+            switch (Inst.Op) {
+                case Opcode::LoadConstant:
+                    Registers[Inst.A] = Func.ConstantList[Inst.B];
+                    break;
+                case Opcode::Move:
+                    Registers[Inst.A] = Registers[Inst.B];
+                    break;
+                case Opcode::Convert:
+                    Registers[Inst.A] =
+                        ConvertValue(Registers[Inst.B], *Inst.Type);
+                    break;
+                case Opcode::Add:
+                case Opcode::Subtract:
+                case Opcode::Multiply:
+                case Opcode::Divide:
+                case Opcode::Modulo:
+                case Opcode::Power:
+                case Opcode::BitwiseAnd:
+                case Opcode::BitwiseOr:
+                case Opcode::BitwiseXor:
+                case Opcode::LeftShift:
+                case Opcode::RightShift:
+                case Opcode::LessThan:
+                case Opcode::GreaterThan:
+                case Opcode::LessThanOrEqual:
+                case Opcode::GreaterThanOrEqual:
+                case Opcode::Equality:
+                case Opcode::Inequality: {
+                    const auto Result =
+                        ApplyBinaryOpcode(Inst.Op,
+                                          *Inst.Type,
+                                          Registers[Inst.B],
+                                          Registers[Inst.C]);
+
+                    if (!Result.has_value()) {
+                        return Fail(Index - 1, Result.error());
+                    }
+
+                    Registers[Inst.A] = Result.value();
+                    break;
+                }
+                case Opcode::Negate:
+                case Opcode::BitwiseNot:
+                case Opcode::LogicalNot: {
+                    const auto Result =
+                        ApplyUnaryOpcode(Inst.Op, *Inst.Type,
+                                         Registers[Inst.B]);
+
+                    if (!Result.has_value()) {
+                        return Fail(Index - 1, Result.error());
+                    }
+
+                    Registers[Inst.A] = Result.value();
+                    break;
+                }
+                case Opcode::Jump:
+                    Index = Inst.B;
+                    break;
+                case Opcode::JumpIfFalse:
+                    if (!Registers[Inst.A].isTrue()) {
+                        Index = Inst.B;
+                    }
+
+                    break;
+                case Opcode::JumpIfTrue:
+                    if (Registers[Inst.A].isTrue()) {
+                        Index = Inst.B;
+                    }
+
+                    break;
+                case Opcode::Call: {
+                    const auto Result =
+                        this->call(*Func.CalleeList[Inst.B],
+                                   Base + Inst.C,
+                                   Base + Func.RegisterCount,
+                                   Func.LocationList[Index - 1]);
+
+                    if (!Result.has_value()) {
+                        return std::nullopt;
+                    }
+
+                    // The call may have grown the stack.
+                    Registers = this->RegisterStack.data() + Base;
+                    Registers[Inst.A] = Result.value();
+
+                    break;
+                }
+                case Opcode::Return:
+                    if (Inst.A != NoRegister) {
+                        return Registers[Inst.A];
+                    }
+
+                    if (!Func.ReturnType->isVoid()) {
+                        return Fail(Index - 1,
+                                    "Function ended without returning a "
+                                    "value");
+                    }
+
+                    return Value();
+            }
+        }
+    }
+
+    // Calls Callee with the arguments in the registers starting at ArgBase,
+    // giving it the registers starting at Base.
+
+    auto
+    Evaluator::call(const Function &Callee,
+                    const size_t ArgBase,
+                    const size_t Base,
+                    const SourceLocation Loc) noexcept -> std::optional<Value>
+    {
+        switch (Callee.State) {
+            case Function::CompileState::Compiled:
+                break;
+            case Function::CompileState::Failed:
+                return std::nullopt;
+            case Function::CompileState::NotCompiled:
+            case Function::CompileState::Compiling:
+                this->Diag.consume({
+                    .Level = DiagnosticLevel::Error,
+                    .Location = Loc,
+                    .Message =
+                        "Function is called to compute a value its own body "
+                        "depends on"
+                });
+
+                return std::nullopt;
+        }
+
+        const auto ParamCount = Callee.ParamTypeList.size();
+        const auto ArgList =
+            std::span<const Value>(this->RegisterStack.data() + ArgBase,
+                                   ParamCount);
+
+        if (const auto Iter =
+                this->CallResultMap.find(CallKeyRef {
+                    .Callee = &Callee,
+                    .ArgList = ArgList
+                });
+            Iter != this->CallResultMap.end())
+        {
+            return Iter->second;
+        }
+
+        if (this->CallDepth == MaxCallDepth) {
+            this->Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Loc,
+                .Message = "Compile-time calls are nested too deeply"
+            });
+
+            return std::nullopt;
+        }
+
+        if (this->RegisterStack.size() < Base + Callee.RegisterCount) {
+            this->RegisterStack.resize(Base + Callee.RegisterCount);
+        }
+
+        std::copy_n(this->RegisterStack.begin() + ArgBase, ParamCount,
+                    this->RegisterStack.begin() + Base);
+
+        this->CallDepth++;
+        const auto Result = this->run(Callee, Base);
+        this->CallDepth--;
+
+        if (!Result.has_value()) {
+            return std::nullopt;
+        }
+
+        // The callee's registers are all above the arguments, so they're
+        // still in place.
+
+        const auto ArgBegin = this->RegisterStack.begin() + ArgBase;
+        this->CallResultMap.emplace(
+            CallKey {
+                .Callee = &Callee,
+                .ArgList = std::vector<Value>(ArgBegin, ArgBegin + ParamCount)
+            },
+            Result.value());
+
+        return Result;
+    }
+
+    auto Evaluator::getFunction(const AST::FunctionDecl &Decl) noexcept
+        -> Function *
+    {
+        if (const auto Iter = this->FunctionMap.find(&Decl);
+            Iter != this->FunctionMap.end())
+        {
+            const auto Func = Iter->second.get();
+            if (Func->State == Function::CompileState::Failed) {
+                return nullptr;
+            }
+
+            // A function being compiled is returned as well, so it can call
+            // itself.
+            return Func;
+        }
+
+        const auto Func =
+            this->FunctionMap.emplace(&Decl, std::make_unique<Function>())
+                .first->second.get();
+
+        Func->Decl = &Decl;
+        Func->State = Function::CompileState::Compiling;
+
+        if (!CompileFunction(*this, *Func)) {
+            Func->State = Function::CompileState::Failed;
+            return nullptr;
+        }
+
+        Func->State = Function::CompileState::Compiled;
+        return Func;
+    }
+
+    auto
+    Evaluator::evaluate(const AST::Expr &Expr,
+                        const AST::Expr *const TypeExpr) noexcept
+        -> std::optional<Value>
+    {
+        auto Thunk = Function();
+        if (!CompileExpr(*this, Expr, TypeExpr, Thunk)) {
+            return std::nullopt;
+        }
+
+        // Code only runs once it's compiled, and compiling never runs inside
+        // code that's running, so the thunk has the whole stack.
+
+        this->StepsLeft = MaxStepCount;
+        return this->run(Thunk, /*Base=*/0);
+    }
+
+    auto Evaluator::evaluateDecl(const AST::VarDecl &Decl) noexcept
+        -> std::optional<Value>
+    {
+        const auto Report = [&](std::string &&Message) noexcept {
+            this->Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Decl.getNameLoc(),
+                .Message = std::move(Message)
+            });
+        };
+
+        if (const auto Iter = this->DeclMap.find(&Decl);
+            Iter != this->DeclMap.end())
+        {
+            switch (Iter->second.State) {
+                case DeclState::Evaluated:
+                    return Iter->second.Result;
+                case DeclState::Failed:
+                    return std::nullopt;
+                case DeclState::Evaluating:
+                    Report(std::format("\"{}\" depends on its own value",
+                                       Decl.getName()));
+                    return std::nullopt;
+            }
+        }
+
+        const auto &Quals = Decl.getQualifiers();
+        if (Decl.hasSlot() ||
+            Quals.isMutable() ||
+            Quals.isVolatile() ||
+            Quals.isExtern())
+        {
+            Report(std::format("\"{}\" can change, so it can't be read at "
+                               "compile time",
+                               Decl.getName()));
+
+            this->DeclMap.insert_or_assign(&Decl, DeclEntry {
+                .State = DeclState::Failed
+            });
+
+            return std::nullopt;
+        }
+
+        const auto InitExpr = Decl.getInitExpr();
+        if (InitExpr == nullptr) {
+            Report(std::format("\"{}\" has no value to read at compile time",
+                               Decl.getName()));
+
+            this->DeclMap.insert_or_assign(&Decl, DeclEntry {
+                .State = DeclState::Failed
+            });
+
+            return std::nullopt;
+        }
+
+        this->DeclMap.insert_or_assign(&Decl, DeclEntry {
+            .State = DeclState::Evaluating
+        });
+
+        const auto Result = this->evaluate(*InitExpr, Decl.getTypeExpr());
+        this->DeclMap.insert_or_assign(&Decl, DeclEntry {
+            .State =
+                Result.has_value() ? DeclState::Evaluated : DeclState::Failed,
+            .Result = Result.value_or(Value())
+        });
+
+        return Result;
+    }
+
+    auto
+    EvaluateComptimeDecls(const Parse::ParseUnit &Unit,
+                          DiagnosticConsumer &Diag) noexcept -> bool
+    {
+        auto Eval = Evaluator(Diag);
+        auto Success = true;
+
+        for (const auto Stmt : Unit.getTopLevelStmtList()) {
+            const auto Decl = llvm::dyn_cast<AST::VarDecl>(Stmt);
+            if (Decl != nullptr && Decl->getQualifiers().isComptime()) {
+                Success &= Eval.evaluateDecl(*Decl).has_value();
+            }
+        }
+
+        return Success;
+    }
+}
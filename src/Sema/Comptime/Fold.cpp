@@ -0,0 +1,480 @@
+/*
+ * Sema/Comptime/Fold.cpp
+ * © suhas pai
+ */
+
+#include "ADT/BumpAllocator.h"
+
+#include "AST/Decls/EnumDecl.h"
+#include "AST/Decls/FunctionDecl.h"
+#include "AST/Decls/LvalueNamedDecl.h"
+#include "AST/Decls/StructDecl.h"
+
+#include "AST/BinaryOperation.h"
+#include "AST/CallExpr.h"
+#include "AST/CastExpr.h"
+#include "AST/CharLiteral.h"
+#include "AST/CompoundStmt.h"
+#include "AST/DeclRefExpr.h"
+#include "AST/ForStmt.h"
+#include "AST/IfExpr.h"
+#include "AST/NumberLiteral.h"
+#include "AST/ParenExpr.h"
+#include "AST/ReturnStmt.h"
+#include "AST/UnaryOperation.h"
+
+#include "llvm/Support/Casting.h"
+
+#include "Sema/Comptime/Fold.h"
+#include "Sema/Comptime/TypeRules.h"
+
+namespace Sema::Comptime {
+    // Only floating-point types the host has are folded.
+    static auto CanFoldType(const BuiltinType &Type) noexcept {
+        return !Type.isVoid() &&
+               (!Type.isFloatingPoint() || Type.getBitWidth() >= 32);
+    }
+
+    // Returns the value of NumLit, or std::nullopt if it doesn't fit in its
+    // type.
+
+    static auto LiteralValue(const AST::NumberLiteral &NumLit) noexcept
+        -> std::optional<Value>
+    {
+        const auto &Number = NumLit.getNumber().Success;
+        auto Literal = Value();
+
+        switch (Number.Kind) {
+            case Lex::NumberKind::UnsignedInteger:
+                // Only literals too large for an s64 are unsigned.
+                Literal =
+                    Value::Integer(Number.UInt > INT64_MAX ?
+                                    BuiltinType::u64() : BuiltinType::s64(),
+                                   Number.UInt);
+                break;
+            case Lex::NumberKind::SignedInteger:
+                Literal = Value::Integer(BuiltinType::s64(), Number.UInt);
+                break;
+            case Lex::NumberKind::FloatingPoint:
+                Literal =
+                    Value::FloatingPoint(BuiltinType::f64(), Number.Float64);
+                break;
+        }
+
+        const auto Type = BuiltinType::forName(Number.Suffix);
+        if (Type == nullptr) {
+            return Literal;
+        }
+
+        if (!CanFoldType(*Type)) {
+            return std::nullopt;
+        }
+
+        const auto Result = ConvertValue(Literal, *Type);
+        if (Number.Kind != Lex::NumberKind::FloatingPoint &&
+            !Type->isFloatingPoint() &&
+            ConvertValue(Result, Literal.getType()) != Literal)
+        {
+            return std::nullopt;
+        }
+
+        return Result;
+    }
+
+    // Returns a literal of Constant. Its suffix names the type of Constant,
+    // so codegen gives it the type of the expression it replaces.
+
+    static auto
+    MakeLiteral(const Value Constant, const SourceLocation Loc) noexcept
+        -> AST::NumberLiteral &
+    {
+        const auto &Type = Constant.getType();
+        auto Number = Lex::ParseNumberResult();
+
+        Number.Success.Suffix = Type.getName();
+        if (Type.isFloatingPoint()) {
+            Number.Success.Kind = Lex::NumberKind::FloatingPoint;
+            Number.Success.Float64 = Constant.asFloat();
+        } else if (Type.isSignedInteger()) {
+            Number.Success.Kind = Lex::NumberKind::SignedInteger;
+            Number.Success.SInt = Constant.asSInt();
+        } else {
+            Number.Success.Kind = Lex::NumberKind::UnsignedInteger;
+            Number.Success.UInt = Constant.asUInt();
+        }
+
+        return ADT::ArenaNew<AST::NumberLiteral>(Loc, Number);
+    }
+
+    struct ConstantFolder {
+    protected:
+        // Returns the value of Expr, once its operands have been folded, if
+        // it's a literal, or a literal in parentheses or negated.
+
+        auto valueOf(const AST::Expr &Expr) noexcept -> std::optional<Value> {
+            if (const auto NumLit = llvm::dyn_cast<AST::NumberLiteral>(&Expr)) {
+                return LiteralValue(*NumLit);
+            }
+
+            if (const auto CharLit = llvm::dyn_cast<AST::CharLiteral>(&Expr)) {
+                return Value::Integer(BuiltinType::u8(),
+                                      static_cast<uint8_t>(
+                                        CharLit->getValue()));
+            }
+
+            if (const auto ParenExpr = llvm::dyn_cast<AST::ParenExpr>(&Expr)) {
+                return this->valueOf(*ParenExpr->getChildExpr());
+            }
+
+            if (const auto UnaryOp =
+                    llvm::dyn_cast<AST::UnaryOperation>(&Expr))
+            {
+                return this->applyUnaryOperation(*UnaryOp);
+            }
+
+            return std::nullopt;
+        }
+
+        // Converts Operand, the value of Expr, to type To. A number literal
+        // that doesn't fit in To isn't converted, so codegen can report it.
+
+        auto
+        convert(const Value Operand,
+                const BuiltinType &To,
+                const AST::Expr &Expr) noexcept -> std::optional<Value>
+        {
+            const auto &From = Operand.getType();
+            const auto Result = ConvertValue(Operand, To);
+
+            if (IsUntypedLiteral(Expr) &&
+                To.isInteger() &&
+                !From.isFloatingPoint() &&
+                ConvertValue(Result, From) != Operand)
+            {
+                return std::nullopt;
+            }
+
+            return Result;
+        }
+
+        auto applyUnaryOperation(const AST::UnaryOperation &UnaryOp) noexcept
+            -> std::optional<Value>
+        {
+            auto Op = Opcode();
+            switch (UnaryOp.getOperator()) {
+                case Parse::UnaryOperator::Negate:
+                    Op = Opcode::Negate;
+                    break;
+                case Parse::UnaryOperator::BitwiseNot:
+                    Op = Opcode::BitwiseNot;
+                    break;
+                case Parse::UnaryOperator::LogicalNot:
+                    Op = Opcode::LogicalNot;
+                    break;
+                default:
+                    return std::nullopt;
+            }
+
+            const auto Operand = this->valueOf(UnaryOp.getOperand());
+            if (!Operand.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto Result =
+                ApplyUnaryOpcode(Op, Operand->getType(), Operand.value());
+
+            if (!Result.has_value()) {
+                return std::nullopt;
+            }
+
+            return Result.value();
+        }
+
+        // Codegen computes both operands of && and ||, so they're only
+        // folded when both are constant.
+
+        auto applyBinaryOperation(const AST::BinaryOperation &BinOp) noexcept
+            -> std::optional<Value>
+        {
+            if (BinOp.isAssignmentOperation()) {
+                return std::nullopt;
+            }
+
+            const auto Left = this->valueOf(BinOp.getLhs());
+            if (!Left.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto Right = this->valueOf(BinOp.getRhs());
+            if (!Right.has_value()) {
+                return std::nullopt;
+            }
+
+            switch (BinOp.getOperator()) {
+                case Parse::BinaryOperator::LogicalAnd:
+                    return Value::Bool(Left->isTrue() && Right->isTrue());
+                case Parse::BinaryOperator::LogicalOr:
+                    return Value::Bool(Left->isTrue() || Right->isTrue());
+                default:
+                    break;
+            }
+
+            const auto Op = BinaryOperatorToOpcode(BinOp.getOperator());
+            if (!Op.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto &Type =
+                GetOperandType(BinOp, Left->getType(), Right->getType());
+
+            const auto LeftValue =
+                this->convert(Left.value(), Type, BinOp.getLhs());
+            const auto RightValue =
+                this->convert(Right.value(), Type, BinOp.getRhs());
+
+            if (!LeftValue.has_value() || !RightValue.has_value()) {
+                return std::nullopt;
+            }
+
+            const auto Result =
+                ApplyBinaryOpcode(Op.value(), Type, LeftValue.value(),
+                                  RightValue.value());
+
+            if (!Result.has_value()) {
+                return std::nullopt;
+            }
+
+            return Result.value();
+        }
+
+        // Until Sema resolves types, only casts to builtin types are folded.
+        auto applyCastExpr(const AST::CastExpr &Cast) noexcept
+            -> std::optional<Value>
+        {
+            const auto DeclRef =
+                llvm::dyn_cast<AST::DeclRefExpr>(Cast.getTypeExpr());
+
+            if (DeclRef == nullptr) {
+                return std::nullopt;
+            }
+
+            const auto Type = BuiltinType::forName(DeclRef->getName());
+            if (Type == nullptr || !CanFoldType(*Type)) {
+                return std::nullopt;
+            }
+
+            const auto Operand = this->valueOf(*Cast.getOperand());
+            if (!Operand.has_value()) {
+                return std::nullopt;
+            }
+
+            return ConvertValue(Operand.value(), *Type);
+        }
+
+        void foldStmtList(std::span<AST::Stmt *> &StmtList) noexcept {
+            auto Count = size_t();
+            for (const auto Stmt : StmtList) {
+                if (const auto Result = this->foldStmt(*Stmt)) {
+                    StmtList[Count++] = Result;
+                }
+            }
+
+            StmtList = StmtList.first(Count);
+        }
+
+        // Folds the condition and branches of IfStmt. Returns the branch
+        // taken if the condition is constant, which is null if it's a
+        // missing else, or else IfStmt.
+
+        auto foldIfExpr(AST::IfExpr &IfStmt) noexcept -> AST::Stmt * {
+            auto &Cond = this->foldExpr(*IfStmt.getCond());
+            IfStmt.setCond(Cond);
+
+            auto Then = this->foldStmt(*IfStmt.getThen());
+            auto Else =
+                IfStmt.getElse() != nullptr ?
+                    this->foldStmt(*IfStmt.getElse()) : nullptr;
+
+            if (const auto CondValue = this->valueOf(Cond)) {
+                return CondValue->isTrue() ? Then : Else;
+            }
+
+            // A then-branch that was an if taking its missing else does
+            // nothing.
+
+            if (Then == nullptr) {
+                Then =
+                    &ADT::ArenaNew<AST::CompoundStmt>(
+                        IfStmt.getThen()->getLoc(),
+                        std::span<AST::Stmt *>());
+            }
+
+            IfStmt.setThen(Then);
+            IfStmt.setElse(Else);
+
+            return &IfStmt;
+        }
+    public:
+        // Folds Expr and its operands. Returns the expression that replaces
+        // Expr, which is Expr itself if it isn't constant.
+
+        auto foldExpr(AST::Expr &Expr) noexcept -> AST::Expr & {
+            switch (Expr.getKind()) {
+                case AST::NodeKind::BinaryOperation: {
+                    auto &BinOp = llvm::cast<AST::BinaryOperation>(Expr);
+
+                    BinOp.setLhs(this->foldExpr(BinOp.getLhs()));
+                    BinOp.setRhs(this->foldExpr(BinOp.getRhs()));
+
+                    if (const auto Result =
+                            this->applyBinaryOperation(BinOp))
+                    {
+                        return MakeLiteral(Result.value(), BinOp.getLoc());
+                    }
+
+                    return BinOp;
+                }
+                case AST::NodeKind::UnaryOperation: {
+                    auto &UnaryOp = llvm::cast<AST::UnaryOperation>(Expr);
+                    UnaryOp.setOperand(this->foldExpr(UnaryOp.getOperand()));
+
+                    // A negated literal without a suffix is kept, as it still
+                    // takes the type of the other operand.
+
+                    if (IsUntypedLiteral(UnaryOp)) {
+                        return UnaryOp;
+                    }
+
+                    if (const auto Result =
+                            this->applyUnaryOperation(UnaryOp))
+                    {
+                        return MakeLiteral(Result.value(), UnaryOp.getLoc());
+                    }
+
+                    return UnaryOp;
+                }
+                case AST::NodeKind::ParenExpr: {
+                    auto &ParenExpr = llvm::cast<AST::ParenExpr>(Expr);
+                    auto &Child = this->foldExpr(*ParenExpr.getChildExpr());
+
+                    if (llvm::isa<AST::NumberLiteral>(Child) &&
+                        !IsUntypedLiteral(Child))
+                    {
+                        return Child;
+                    }
+
+                    ParenExpr.setChildExpr(&Child);
+                    return ParenExpr;
+                }
+                case AST::NodeKind::CastExpr: {
+                    auto &Cast = llvm::cast<AST::CastExpr>(Expr);
+                    Cast.setOperand(&this->foldExpr(*Cast.getOperand()));
+
+                    if (const auto Result = this->applyCastExpr(Cast)) {
+                        return MakeLiteral(Result.value(), Cast.getLoc());
+                    }
+
+                    return Cast;
+                }
+                case AST::NodeKind::CallExpr: {
+                    auto &Call = llvm::cast<AST::CallExpr>(Expr);
+                    for (auto &Arg : Call.getArgumentListRef()) {
+                        Arg.Expr = &this->foldExpr(*Arg.Expr);
+                    }
+
+                    return Call;
+                }
+                case AST::NodeKind::IfExpr:
+                    // An if used as a value keeps both branches.
+                    this->foldIfExpr(llvm::cast<AST::IfExpr>(Expr));
+                    return Expr;
+                case AST::NodeKind::FunctionDecl: {
+                    auto &FuncDecl = llvm::cast<AST::FunctionDecl>(Expr);
+                    if (const auto Body = FuncDecl.getBody()) {
+                        if (const auto Result = this->foldStmt(*Body)) {
+                            FuncDecl.setBody(*Result);
+                        }
+                    }
+
+                    return FuncDecl;
+                }
+                case AST::NodeKind::EnumDecl:
+                    this->foldStmtList(
+                        llvm::cast<AST::EnumDecl>(Expr).getMemberListRef());
+                    return Expr;
+                case AST::NodeKind::StructDecl:
+                    this->foldStmtList(
+                        llvm::cast<AST::StructDecl>(Expr).getFieldListRef());
+                    return Expr;
+                default:
+                    break;
+            }
+
+            return Expr;
+        }
+
+        // Folds Stmt. Returns the statement that replaces Stmt, or null if
+        // Stmt was an if taking its missing else.
+
+        auto foldStmt(AST::Stmt &Stmt) noexcept -> AST::Stmt * {
+            switch (Stmt.getKind()) {
+                case AST::NodeKind::CompoundStmt:
+                    this->foldStmtList(
+                        llvm::cast<AST::CompoundStmt>(Stmt).getStmtListRef());
+                    return &Stmt;
+                case AST::NodeKind::ReturnStmt: {
+                    auto &RetStmt = llvm::cast<AST::ReturnStmt>(Stmt);
+                    if (const auto Value = RetStmt.getValue()) {
+                        RetStmt.setValue(&this->foldExpr(*Value));
+                    }
+
+                    return &Stmt;
+                }
+                case AST::NodeKind::ForStmt: {
+                    auto &ForStmt = llvm::cast<AST::ForStmt>(Stmt);
+                    if (const auto Cond = ForStmt.getCond()) {
+                        ForStmt.setCond(&this->foldExpr(*Cond));
+                    }
+
+                    if (const auto Body = ForStmt.getBody()) {
+                        if (const auto Result = this->foldStmt(*Body)) {
+                            ForStmt.setBody(Result);
+                        }
+                    }
+
+                    return &Stmt;
+                }
+                case AST::NodeKind::IfExpr:
+                    return this->foldIfExpr(llvm::cast<AST::IfExpr>(Stmt));
+                default:
+                    break;
+            }
+
+            // Declarations aren't expressions, but their value is.
+            if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(&Stmt)) {
+                if (const auto RvalueExpr = Decl->getRvalueExpr()) {
+                    Decl->setRvalueExpr(&this->foldExpr(*RvalueExpr));
+                }
+
+                return &Stmt;
+            }
+
+            if (const auto Expr = llvm::dyn_cast<AST::Expr>(&Stmt)) {
+                return &this->foldExpr(*Expr);
+            }
+
+            return &Stmt;
+        }
+    };
+
+    void FoldConstants(const Parse::ParseUnit &Unit) noexcept {
+        auto Folder = ConstantFolder();
+
+        // The list of top-level statements can't be changed here, so only
+        // what's inside each statement is folded.
+
+        for (const auto Stmt : Unit.getTopLevelStmtList()) {
+            Folder.foldStmt(*Stmt);
+        }
+    }
+}
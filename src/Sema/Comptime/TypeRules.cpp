@@ -0,0 +1,125 @@
+/*
+ * Sema/Comptime/TypeRules.cpp
+ * © suhas pai
+ */
+
+#include "AST/NumberLiteral.h"
+#include "AST/ParenExpr.h"
+#include "AST/UnaryOperation.h"
+
+#include "llvm/Support/Casting.h"
+
+#include "Sema/Comptime/TypeRules.h"
+
+namespace Sema::Comptime {
+    auto IsUntypedLiteral(const AST::Expr &Expr) noexcept -> bool {
+        if (const auto NumLit = llvm::dyn_cast<AST::NumberLiteral>(&Expr)) {
+            return NumLit->getNumber().Success.Suffix.empty();
+        }
+
+        if (const auto ParenExpr = llvm::dyn_cast<AST::ParenExpr>(&Expr)) {
+            return IsUntypedLiteral(*ParenExpr->getChildExpr());
+        }
+
+        if (const auto UnaryOp = llvm::dyn_cast<AST::UnaryOperation>(&Expr)) {
+            return UnaryOp->getOperator() == Parse::UnaryOperator::Negate &&
+                   IsUntypedLiteral(UnaryOp->getOperand());
+        }
+
+        return false;
+    }
+
+    // Nothing rejects mixed operands yet, so pick the type that loses the
+    // least: floating-point over integer, then the wider type.
+
+    auto
+    GetCommonType(const BuiltinType &Left, const BuiltinType &Right) noexcept
+        -> const BuiltinType &
+    {
+        if (Left.isFloatingPoint() != Right.isFloatingPoint()) {
+            return Left.isFloatingPoint() ? Left : Right;
+        }
+
+        return Right.getBitWidth() > Left.getBitWidth() ? Right : Left;
+    }
+
+    auto
+    GetOperandType(const AST::BinaryOperation &BinOp,
+                   const BuiltinType &LeftType,
+                   const BuiltinType &RightType) noexcept
+        -> const BuiltinType &
+    {
+        const auto LeftIsUntyped = IsUntypedLiteral(BinOp.getLhs());
+        const auto RightIsUntyped = IsUntypedLiteral(BinOp.getRhs());
+
+        // A floating-point literal keeps its type next to an integer, or it
+        // would lose its fraction.
+
+        if (LeftIsUntyped && !RightIsUntyped &&
+            (!LeftType.isFloatingPoint() || RightType.isFloatingPoint()))
+        {
+            return RightType;
+        }
+
+        if (RightIsUntyped && !LeftIsUntyped &&
+            (!RightType.isFloatingPoint() || LeftType.isFloatingPoint()))
+        {
+            return LeftType;
+        }
+
+        return GetCommonType(LeftType, RightType);
+    }
+
+    auto BinaryOperatorToOpcode(const Parse::BinaryOperator Oper) noexcept
+        -> std::optional<Opcode>
+    {
+        switch (Oper) {
+            case Parse::BinaryOperator::Add:
+            case Parse::BinaryOperator::AddAssign:
+                return Opcode::Add;
+            case Parse::BinaryOperator::Subtract:
+            case Parse::BinaryOperator::SubtractAssign:
+                return Opcode::Subtract;
+            case Parse::BinaryOperator::Multiply:
+            case Parse::BinaryOperator::MultiplyAssign:
+                return Opcode::Multiply;
+            case Parse::BinaryOperator::Divide:
+            case Parse::BinaryOperator::DivideAssign:
+                return Opcode::Divide;
+            case Parse::BinaryOperator::Modulo:
+            case Parse::BinaryOperator::ModuloAssign:
+                return Opcode::Modulo;
+            case Parse::BinaryOperator::Power:
+                return Opcode::Power;
+            case Parse::BinaryOperator::BitwiseAnd:
+            case Parse::BinaryOperator::BitwiseAndAssign:
+                return Opcode::BitwiseAnd;
+            case Parse::BinaryOperator::BitwiseOr:
+            case Parse::BinaryOperator::BitwiseOrAssign:
+                return Opcode::BitwiseOr;
+            case Parse::BinaryOperator::BitwiseXor:
+            case Parse::BinaryOperator::BitwiseXorAssign:
+                return Opcode::BitwiseXor;
+            case Parse::BinaryOperator::LeftShift:
+            case Parse::BinaryOperator::LeftShiftAssign:
+                return Opcode::LeftShift;
+            case Parse::BinaryOperator::RightShift:
+            case Parse::BinaryOperator::RightShiftAssign:
+                return Opcode::RightShift;
+            case Parse::BinaryOperator::LessThan:
+                return Opcode::LessThan;
+            case Parse::BinaryOperator::GreaterThan:
+                return Opcode::GreaterThan;
+            case Parse::BinaryOperator::LessThanOrEqual:
+                return Opcode::LessThanOrEqual;
+            case Parse::BinaryOperator::GreaterThanOrEqual:
+                return Opcode::GreaterThanOrEqual;
+            case Parse::BinaryOperator::Equality:
+                return Opcode::Equality;
+            case Parse::BinaryOperator::Inequality:
+                return Opcode::Inequality;
+            default:
+                return std::nullopt;
+        }
+    }
+}
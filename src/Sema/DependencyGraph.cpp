@@ -0,0 +1,142 @@
+/*
+ * Sema/DependencyGraph.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_set>
+
+#include "Sema/DependencyGraph.h"
+
+namespace Sema {
+    static void
+    SortAndRemoveDuplicates(std::vector<std::string> &List) noexcept {
+        std::ranges::sort(List);
+
+        const auto Duplicates = std::ranges::unique(List);
+        List.erase(Duplicates.begin(), Duplicates.end());
+    }
+
+    auto
+    DependencyGraph::setNode(const AST::Stmt &Stmt, Node &&NewNode) noexcept
+        -> decltype(*this)
+    {
+        this->removeNode(Stmt);
+
+        SortAndRemoveDuplicates(NewNode.DeclaredNameList);
+        SortAndRemoveDuplicates(NewNode.UsedNameList);
+
+        const auto AddUser = [&](const std::string &Name) noexcept {
+            if (const auto Iter = this->UserListMap.find(Name);
+                Iter != this->UserListMap.end())
+            {
+                Iter->second.push_back(&Stmt);
+                return;
+            }
+
+            this->UserListMap.emplace(Name,
+                                      std::vector<const AST::Stmt *>({&Stmt}));
+        };
+
+        for (const auto &Name : NewNode.DeclaredNameList) {
+            AddUser(Name);
+        }
+
+        for (const auto &Name : NewNode.UsedNameList) {
+            if (!std::ranges::binary_search(NewNode.DeclaredNameList, Name)) {
+                AddUser(Name);
+            }
+        }
+
+        this->NodeMap.insert_or_assign(&Stmt, std::move(NewNode));
+        return *this;
+    }
+
+    auto DependencyGraph::removeNode(const AST::Stmt &Stmt) noexcept
+        -> decltype(*this)
+    {
+        const auto NodeIter = this->NodeMap.find(&Stmt);
+        if (NodeIter == this->NodeMap.end()) {
+            return *this;
+        }
+
+        const auto RemoveUser = [&](const std::string &Name) noexcept {
+            const auto Iter = this->UserListMap.find(Name);
+            if (Iter == this->UserListMap.end()) {
+                return;
+            }
+
+            std::erase(Iter->second, &Stmt);
+            if (Iter->second.empty()) {
+                this->UserListMap.erase(Iter);
+            }
+        };
+
+        for (const auto &Name : NodeIter->second.DeclaredNameList) {
+            RemoveUser(Name);
+        }
+
+        for (const auto &Name : NodeIter->second.UsedNameList) {
+            RemoveUser(Name);
+        }
+
+        this->NodeMap.erase(NodeIter);
+        return *this;
+    }
+
+    auto DependencyGraph::getNode(const AST::Stmt &Stmt) const noexcept
+        -> const Node *
+    {
+        if (const auto Iter = this->NodeMap.find(&Stmt);
+            Iter != this->NodeMap.end())
+        {
+            return &Iter->second;
+        }
+
+        return nullptr;
+    }
+
+    auto
+    DependencyGraph::collectDependents(
+        const std::span<const std::string> NameList) const noexcept
+            -> std::vector<const AST::Stmt *>
+    {
+        auto Result = std::vector<const AST::Stmt *>();
+        auto VisitedSet = std::unordered_set<const AST::Stmt *>();
+        auto WorkList =
+            std::vector<std::string_view>(NameList.begin(), NameList.end());
+
+        while (!WorkList.empty()) {
+            const auto Name = WorkList.back();
+            WorkList.pop_back();
+
+            const auto Iter = this->UserListMap.find(Name);
+            if (Iter == this->UserListMap.end()) {
+                continue;
+            }
+
+            for (const auto User : Iter->second) {
+                if (!VisitedSet.insert(User).second) {
+                    continue;
+                }
+
+                Result.push_back(User);
+                for (const auto &Declared :
+                        this->NodeMap.at(User).DeclaredNameList)
+                {
+                    WorkList.push_back(Declared);
+                }
+            }
+        }
+
+        return Result;
+    }
+
+    auto DependencyGraph::clear() noexcept -> decltype(*this) {
+        this->NodeMap.clear();
+        this->UserListMap.clear();
+
+        return *this;
+    }
+}
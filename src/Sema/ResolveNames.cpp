@@ -0,0 +1,740 @@
+/*
+ * Sema/ResolveNames.cpp
+ * © suhas pai
+ */
+
+#include <format>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ADT/Parallel.h"
+
+#include "AST/Decls/ArrayBindingVarDecl.h"
+#include "AST/Decls/ObjectBindingVarDecl.h"
+#include "AST/Visitor.h"
+
+#include "Sema/ResolveNames.h"
+#include "Sema/SymbolTable.h"
+#include "Sema/Types/Builtin.h"
+
+namespace Sema {
+    struct NameResolver : public AST::StmtVisitor<NameResolver> {
+    protected:
+        const Parse::ParseUnit &Unit;
+        DiagnosticConsumer &Diag;
+
+        // Holds the names declared inside functions. Top-level names are
+        // found in Unit instead.
+        SymbolTable Table;
+
+        // Names of top-level binding declarations, declared by another
+        // resolver. Only read, so resolvers on several threads can share it.
+        const SymbolTable *TopLevelBindingTable;
+
+        // If set, every name declared is added to DeclaredNameList, and
+        // every name used that isn't declared in Table to UsedNameList.
+        std::vector<std::string> *DeclaredNameList = nullptr;
+        std::vector<std::string> *UsedNameList = nullptr;
+
+        // If set, every name reference resolved is added to DeclRefList.
+        std::vector<AST::DeclRefExpr *> *DeclRefList = nullptr;
+
+        // Slots given out so far in the outermost function being resolved.
+        // Functions nested in it keep counting, so all of them share one
+        // set of slots.
+        uint32_t SlotCount = 0;
+
+        bool InFunction : 1 = false;
+        bool InTypeExpr : 1 = false;
+        bool HasErrors : 1 = false;
+        bool ReportRedeclarations : 1 = true;
+
+        void declare(const std::string_view Name,
+                     const SourceLocation NameLoc,
+                     AST::Stmt &Decl) noexcept
+        {
+            if (this->DeclaredNameList != nullptr) {
+                this->DeclaredNameList->emplace_back(Name);
+            }
+
+            if (this->Table.addDecl(Name, Decl) == nullptr ||
+                !this->ReportRedeclarations)
+            {
+                return;
+            }
+
+            this->Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = NameLoc,
+                .Message =
+                    std::format("\"{}\" is already declared in this scope",
+                                Name)
+            });
+
+            this->HasErrors = true;
+        }
+
+        void
+        declareArrayBindingItemList(
+            const std::span<AST::ArrayBindingItem *const> ItemList,
+            AST::Stmt &Decl) noexcept
+        {
+            for (const auto Item : ItemList) {
+                switch (Item->getKind()) {
+                    case AST::ArrayBindingItemKind::Identifier: {
+                        const auto Identifier =
+                            llvm::cast<AST::ArrayBindingItemIdentifier>(Item);
+
+                        this->declare(Identifier->getName(),
+                                      Identifier->getNameLoc(),
+                                      Decl);
+                        break;
+                    }
+                    case AST::ArrayBindingItemKind::Array:
+                        this->declareArrayBindingItemList(
+                            llvm::cast<AST::ArrayBindingItemArray>(Item)
+                                ->getItemList(),
+                            Decl);
+                        break;
+                    case AST::ArrayBindingItemKind::Object:
+                        this->declareObjectBindingFieldList(
+                            llvm::cast<AST::ArrayBindingItemObject>(Item)
+                                ->getFieldList(),
+                            Decl);
+                        break;
+                    case AST::ArrayBindingItemKind::Spread: {
+                        const auto Spread =
+                            llvm::cast<AST::ArrayBindingItemSpread>(Item);
+
+                        this->declare(Spread->getName(),
+                                      Spread->getNameLoc(),
+                                      Decl);
+                        break;
+                    }
+                }
+            }
+        }
+
+        void
+        declareObjectBindingFieldList(
+            const std::span<AST::ObjectBindingField *const> FieldList,
+            AST::Stmt &Decl) noexcept
+        {
+            for (const auto Field : FieldList) {
+                switch (Field->getKind()) {
+                    case AST::ObjectBindingFieldKind::Identifier: {
+                        const auto Identifier =
+                            llvm::cast<AST::ObjectBindingFieldIdentifier>(
+                                Field);
+
+                        this->declare(Identifier->getName(),
+                                      Identifier->getNameLoc(),
+                                      Decl);
+                        break;
+                    }
+                    case AST::ObjectBindingFieldKind::Array:
+                        this->declareArrayBindingItemList(
+                            llvm::cast<AST::ObjectBindingFieldArray>(Field)
+                                ->getItemList(),
+                            Decl);
+                        break;
+                    case AST::ObjectBindingFieldKind::Object:
+                        this->declareObjectBindingFieldList(
+                            llvm::cast<AST::ObjectBindingFieldObject>(Field)
+                                ->getFieldList(),
+                            Decl);
+                        break;
+                    case AST::ObjectBindingFieldKind::Spread:
+                        this->declare(Field->getKey(),
+                                      Field->getKeyLoc(),
+                                      Decl);
+                        break;
+                }
+            }
+        }
+
+        // Declares the names Stmt introduces, if it's a declaration.
+        void declareStmt(AST::Stmt &Stmt) noexcept {
+            if (const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(&Stmt)) {
+                if (this->InFunction) {
+                    Decl->setSlot(this->SlotCount++);
+                }
+
+                this->declare(Decl->getName(), Decl->getNameLoc(), *Decl);
+                return;
+            }
+
+            if (const auto Decl =
+                    llvm::dyn_cast<AST::ArrayBindingVarDecl>(&Stmt))
+            {
+                this->declareArrayBindingItemList(Decl->getItemList(), *Decl);
+                return;
+            }
+
+            if (const auto Decl =
+                    llvm::dyn_cast<AST::ObjectBindingVarDecl>(&Stmt))
+            {
+                this->declareObjectBindingFieldList(Decl->getFieldList(),
+                                                    *Decl);
+            }
+        }
+
+        // Resolves a statement of a block, then declares its names for the
+        // statements after it. A variable initialized with a function is
+        // declared first, so the function can call itself.
+
+        void resolveBlockStmt(AST::Stmt &Stmt) noexcept {
+            const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(&Stmt);
+            if (Decl != nullptr &&
+                llvm::isa_and_nonnull<AST::FunctionDecl>(
+                    Decl->getRvalueExpr()))
+            {
+                this->declareStmt(Stmt);
+                this->resolve(&Stmt);
+
+                return;
+            }
+
+            this->resolve(&Stmt);
+            this->declareStmt(Stmt);
+        }
+
+        void resolveList(const std::span<AST::Stmt *const> StmtList) noexcept {
+            for (const auto Stmt : StmtList) {
+                this->resolve(Stmt);
+            }
+        }
+
+        void resolveType(AST::Stmt *const TypeExpr) noexcept {
+            const auto WasInTypeExpr = this->InTypeExpr;
+
+            this->InTypeExpr = true;
+            this->resolve(TypeExpr);
+            this->InTypeExpr = WasInTypeExpr;
+        }
+
+        void resolveValue(AST::Stmt *const Expr) noexcept {
+            const auto WasInTypeExpr = this->InTypeExpr;
+
+            this->InTypeExpr = false;
+            this->resolve(Expr);
+            this->InTypeExpr = WasInTypeExpr;
+        }
+
+        void resolveLvalueTypedDecl(AST::LvalueTypedDecl &Decl) noexcept {
+            this->resolveType(Decl.getTypeExpr());
+            this->resolve(Decl.getRvalueExpr());
+        }
+    public:
+        explicit
+        NameResolver(const Parse::ParseUnit &Unit,
+                     DiagnosticConsumer &Diag,
+                     const SymbolTable *const TopLevelBindingTable) noexcept
+        : Unit(Unit), Diag(Diag), TopLevelBindingTable(TopLevelBindingTable) {}
+
+        [[nodiscard]] constexpr auto &getTable() const noexcept {
+            return this->Table;
+        }
+
+        [[nodiscard]] constexpr auto hasErrors() const noexcept {
+            return this->HasErrors;
+        }
+
+        constexpr auto
+        setUsedNameList(std::vector<std::string> *const List) noexcept
+            -> decltype(*this)
+        {
+            this->UsedNameList = List;
+            return *this;
+        }
+
+        constexpr auto
+        setDeclRefList(std::vector<AST::DeclRefExpr *> *const List) noexcept
+            -> decltype(*this)
+        {
+            this->DeclRefList = List;
+            return *this;
+        }
+
+        // Top-level binding declarations don't have an LvalueNamedDecl for
+        // each name, so they aren't in the unit's list of top-level decls.
+        // Their names go in an outermost scope instead. Redeclarations are
+        // only reported for statements in ReportSet, or for every statement
+        // if ReportSet is null.
+
+        void
+        declareTopLevelBindings(
+            const std::unordered_set<const AST::Stmt *> *const ReportSet)
+                noexcept
+        {
+            this->Table.pushScope();
+            for (const auto Stmt : this->Unit.getTopLevelStmtList()) {
+                if (llvm::isa<AST::LvalueNamedDecl>(Stmt)) {
+                    continue;
+                }
+
+                this->ReportRedeclarations =
+                    ReportSet == nullptr || ReportSet->contains(Stmt);
+
+                this->declareStmt(*Stmt);
+            }
+
+            this->ReportRedeclarations = true;
+        }
+
+        // Adds the names the top-level statement Stmt declares to List.
+        void
+        collectDeclaredNames(AST::Stmt &Stmt,
+                             std::vector<std::string> &List) noexcept
+        {
+            this->DeclaredNameList = &List;
+            this->ReportRedeclarations = false;
+            this->Table.pushScope();
+
+            this->declareStmt(Stmt);
+
+            this->Table.popScope();
+            this->ReportRedeclarations = true;
+            this->DeclaredNameList = nullptr;
+        }
+
+        void resolve(AST::Stmt *const Stmt) noexcept {
+            if (Stmt != nullptr) {
+                this->visit(*Stmt);
+            }
+        }
+
+        void visitStmt(AST::Stmt &) noexcept {}
+
+        void visitDeclRefExpr(AST::DeclRefExpr &Expr) noexcept {
+            if (this->DeclRefList != nullptr) {
+                this->DeclRefList->push_back(&Expr);
+            }
+
+            const auto Name = Expr.getName();
+            if (const auto Decl = this->Table.lookup(Name)) {
+                Expr.setDecl(Decl);
+                return;
+            }
+
+            if (this->UsedNameList != nullptr) {
+                this->UsedNameList->emplace_back(Name);
+            }
+
+            if (const auto Decl = this->Unit.findTopLevelDeclByName(Name)) {
+                Expr.setDecl(Decl);
+                return;
+            }
+
+            if (this->TopLevelBindingTable != nullptr) {
+                if (const auto Decl = this->TopLevelBindingTable->lookup(Name))
+                {
+                    Expr.setDecl(Decl);
+                    return;
+                }
+            }
+
+            if (this->InTypeExpr || BuiltinType::forName(Name) != nullptr) {
+                return;
+            }
+
+            this->Diag.consume({
+                .Level = DiagnosticLevel::Error,
+                .Location = Expr.getNameLoc(),
+                .Message = std::format("\"{}\" is not declared", Name)
+            });
+
+            this->HasErrors = true;
+        }
+
+        void visitBinaryOperation(AST::BinaryOperation &BinOp) noexcept {
+            this->resolve(&BinOp.getLhs());
+            if (BinOp.getOperator() == Parse::BinaryOperator::As) {
+                this->resolveType(&BinOp.getRhs());
+            } else {
+                this->resolve(&BinOp.getRhs());
+            }
+        }
+
+        void visitUnaryOperation(AST::UnaryOperation &UnaryOp) noexcept {
+            this->resolve(&UnaryOp.getOperand());
+        }
+
+        void visitOptionalUnwrapExpr(AST::OptionalUnwrapExpr &Expr) noexcept {
+            this->resolve(Expr.getBase());
+        }
+
+        void visitParenExpr(AST::ParenExpr &Expr) noexcept {
+            this->resolve(Expr.getChildExpr());
+        }
+
+        void visitArrayDecl(AST::ArrayDecl &Decl) noexcept {
+            this->resolveList(Decl.getElementList());
+        }
+
+        void visitClosureDecl(AST::ClosureDecl &Decl) noexcept {
+            this->resolveList(Decl.getCaptureList());
+            this->visitFunctionDecl(Decl);
+        }
+
+        void visitEnumDecl(AST::EnumDecl &Decl) noexcept {
+            this->resolveList(Decl.getMemberList());
+        }
+
+        // Parameters can refer to each other in any order, so all of them
+        // are declared before any is resolved.
+
+        void visitFunctionDecl(AST::FunctionDecl &Decl) noexcept {
+            const auto WasInFunction = this->InFunction;
+            if (!WasInFunction) {
+                this->InFunction = true;
+                this->SlotCount = 0;
+            }
+
+            this->Table.pushScope();
+            for (const auto Param : Decl.getParamList()) {
+                this->declareStmt(*Param);
+            }
+
+            this->resolveList(Decl.getParamList());
+            this->resolveType(Decl.getReturnTypeExpr());
+            this->resolveValue(Decl.getBody());
+
+            this->Table.popScope();
+
+            Decl.setSlotCount(this->SlotCount);
+            this->InFunction = WasInFunction;
+        }
+
+        void visitInterfaceDecl(AST::InterfaceDecl &Decl) noexcept {
+            this->resolveList(Decl.getFieldList());
+        }
+
+        void visitStructDecl(AST::StructDecl &Decl) noexcept {
+            this->resolveList(Decl.getFieldList());
+        }
+
+        void visitShapeDecl(AST::ShapeDecl &Decl) noexcept {
+            this->resolveList(Decl.getFieldList());
+        }
+
+        void visitTupleDecl(AST::TupleDecl &Decl) noexcept {
+            this->resolveList(Decl.getElementList());
+        }
+
+        void visitUnionDecl(AST::UnionDecl &Decl) noexcept {
+            this->resolveList(Decl.getFieldList());
+        }
+
+        void visitLvalueNamedDecl(AST::LvalueNamedDecl &Decl) noexcept {
+            this->resolve(Decl.getRvalueExpr());
+        }
+
+        void visitEnumMemberDecl(AST::EnumMemberDecl &Decl) noexcept {
+            this->resolve(Decl.getRvalueExpr());
+        }
+
+        void visitFieldDecl(AST::FieldDecl &Decl) noexcept {
+            this->resolveLvalueTypedDecl(Decl);
+        }
+
+        void visitOptionalFieldDecl(AST::OptionalFieldDecl &Decl) noexcept {
+            this->resolveLvalueTypedDecl(Decl);
+        }
+
+        void visitVarDecl(AST::VarDecl &Decl) noexcept {
+            this->resolveLvalueTypedDecl(Decl);
+        }
+
+        void visitParamVarDecl(AST::ParamVarDecl &Decl) noexcept {
+            this->resolveLvalueTypedDecl(Decl);
+        }
+
+        void
+        visitInlineTupleParamVarDecl(
+            AST::InlineTupleParamVarDecl &Decl) noexcept
+        {
+            this->resolveLvalueTypedDecl(Decl);
+        }
+
+        void visitArrayBindingVarDecl(AST::ArrayBindingVarDecl &Decl) noexcept {
+            this->resolve(Decl.getInitExpr());
+        }
+
+        void
+        visitArrayBindingParamVarDecl(
+            AST::ArrayBindingParamVarDecl &Decl) noexcept
+        {
+            this->visitArrayBindingVarDecl(Decl);
+        }
+
+        void
+        visitObjectBindingVarDecl(AST::ObjectBindingVarDecl &Decl) noexcept {
+            this->resolve(Decl.getInitExpr());
+        }
+
+        void
+        visitObjectBindingParamVarDecl(
+            AST::ObjectBindingParamVarDecl &Decl) noexcept
+        {
+            this->visitObjectBindingVarDecl(Decl);
+        }
+
+        void visitCallExpr(AST::CallExpr &Call) noexcept {
+            this->resolve(Call.getCalleeExpr());
+            for (const auto &Arg : Call.getArgumentList()) {
+                this->resolveValue(Arg.Expr);
+            }
+        }
+
+        void visitFieldExpr(AST::FieldExpr &Expr) noexcept {
+            this->resolve(Expr.getBase());
+        }
+
+        void visitIfExpr(AST::IfExpr &Expr) noexcept {
+            this->resolve(Expr.getCond());
+            this->resolve(Expr.getThen());
+            this->resolve(Expr.getElse());
+        }
+
+        void visitArraySubscriptExpr(AST::ArraySubscriptExpr &Expr) noexcept {
+            this->resolve(Expr.getBase());
+            this->resolveList(Expr.getDetailList());
+        }
+
+        void visitCastExpr(AST::CastExpr &Expr) noexcept {
+            this->resolve(Expr.getOperand());
+            this->resolveType(Expr.getTypeExpr());
+        }
+
+        void visitDerefExpr(AST::DerefExpr &Expr) noexcept {
+            this->resolve(Expr.getOperand());
+        }
+
+        void visitArrayTypeExpr(AST::ArrayTypeExpr &Expr) noexcept {
+            this->resolveValue(Expr.getSizeExpr());
+            this->resolveValue(Expr.getConstraintExpr());
+            this->resolve(Expr.getBase());
+        }
+
+        void visitFunctionTypeExpr(AST::FunctionTypeExpr &Expr) noexcept {
+            this->resolveList(Expr.getParamList());
+            this->resolve(Expr.getReturnType());
+        }
+
+        void visitOptionalTypeExpr(AST::OptionalTypeExpr &Expr) noexcept {
+            this->resolve(Expr.getOperand());
+        }
+
+        void visitPointerTypeExpr(AST::PointerTypeExpr &Expr) noexcept {
+            this->resolve(Expr.getOperand());
+        }
+
+        void visitArrayPointerTypeExpr(AST::ArrayPointerTypeExpr &Expr) noexcept
+        {
+            this->resolve(Expr.getBase());
+        }
+
+        void visitCompoundStmt(AST::CompoundStmt &Stmt) noexcept {
+            this->Table.pushScope();
+            for (const auto Child : Stmt.getStmtList()) {
+                this->resolveBlockStmt(*Child);
+            }
+
+            this->Table.popScope();
+        }
+
+        void visitForStmt(AST::ForStmt &Stmt) noexcept {
+            this->Table.pushScope();
+            if (const auto Init = Stmt.getInit()) {
+                this->resolveBlockStmt(*Init);
+            }
+
+            this->resolve(Stmt.getCond());
+            this->resolve(Stmt.getStep());
+            this->resolve(Stmt.getBody());
+
+            this->Table.popScope();
+        }
+
+        void visitCommaSepStmtList(AST::CommaSepStmtList &List) noexcept {
+            this->resolveList(List.getStmtList());
+        }
+
+        void visitReturnStmt(AST::ReturnStmt &Stmt) noexcept {
+            this->resolve(Stmt.getValue());
+        }
+    };
+
+    // Statement lists with fewer functions than this are resolved on one
+    // thread, as starting threads would take longer than resolving them.
+    constexpr static auto ParallelResolveMinFunctionCount = 16;
+
+    struct ResolvedTopLevelStmt {
+        BufferedDiagnosticConsumer Diag = BufferedDiagnosticConsumer();
+        bool HasErrors : 1 = false;
+    };
+
+    [[nodiscard]] static auto
+    CountFunctions(const std::span<AST::Stmt *const> StmtList) noexcept {
+        auto Count = size_t();
+        for (const auto Stmt : StmtList) {
+            const auto Decl = llvm::dyn_cast<AST::LvalueNamedDecl>(Stmt);
+            if (Decl != nullptr &&
+                llvm::isa_and_nonnull<AST::FunctionDecl>(
+                    Decl->getRvalueExpr()))
+            {
+                Count++;
+            }
+        }
+
+        return Count;
+    }
+
+    // Resolves StmtList, a list of the unit's top-level statements in source
+    // order. Every resolved statement's node in Graph is replaced, if Graph
+    // isn't null.
+
+    static auto
+    ResolveTopLevelStmtList(const Parse::ParseUnit &Unit,
+                            const std::span<AST::Stmt *const> StmtList,
+                            const bool IsWholeUnit,
+                            DiagnosticConsumer &Diag,
+                            DependencyGraph *const Graph) noexcept -> bool
+    {
+        const auto ReportSet =
+            IsWholeUnit ?
+                std::unordered_set<const AST::Stmt *>() :
+                std::unordered_set<const AST::Stmt *>(StmtList.begin(),
+                                                      StmtList.end());
+
+        auto BindingResolver = NameResolver(Unit, Diag, nullptr);
+        BindingResolver.declareTopLevelBindings(IsWholeUnit ? nullptr :
+                                                              &ReportSet);
+
+        auto NodeList =
+            std::vector<DependencyGraph::Node>(
+                Graph != nullptr ? StmtList.size() : 0);
+
+        const auto ResolveStmt =
+            [&](const size_t I, DiagnosticConsumer &StmtDiag) noexcept {
+                const auto Stmt = StmtList[I];
+                auto Resolver =
+                    NameResolver(Unit, StmtDiag, &BindingResolver.getTable());
+
+                if (Graph != nullptr) {
+                    Resolver.collectDeclaredNames(*Stmt,
+                                                  NodeList[I].DeclaredNameList);
+                    Resolver.setUsedNameList(&NodeList[I].UsedNameList);
+                    Resolver.setDeclRefList(&NodeList[I].DeclRefList);
+                }
+
+                Resolver.resolve(Stmt);
+                return Resolver.hasErrors();
+            };
+
+        auto HasErrors = BindingResolver.hasErrors();
+        if (CountFunctions(StmtList) < ParallelResolveMinFunctionCount) {
+            for (auto I = size_t(); I != StmtList.size(); I++) {
+                HasErrors |= ResolveStmt(I, Diag);
+            }
+        } else {
+            // Top-level names can be used before they're declared, so each
+            // top-level statement can be resolved on its own, with its own
+            // table. Messages are collected per statement, then replayed in
+            // source order.
+
+            auto ResultList =
+                std::vector<ResolvedTopLevelStmt>(StmtList.size());
+
+            ADT::ForEachInParallel(StmtList.size(),
+                                   [&](const size_t I) noexcept {
+                auto &Result = ResultList[I];
+                Result.HasErrors = ResolveStmt(I, Result.Diag);
+            });
+
+            for (const auto &Result : ResultList) {
+                Result.Diag.replay(Diag);
+                HasErrors |= Result.HasErrors;
+            }
+        }
+
+        if (Graph != nullptr) {
+            for (auto I = size_t(); I != StmtList.size(); I++) {
+                Graph->setNode(*StmtList[I], std::move(NodeList[I]));
+            }
+        }
+
+        return !HasErrors;
+    }
+
+    auto
+    ResolveNames(const Parse::ParseUnit &Unit,
+                 DiagnosticConsumer &Diag,
+                 DependencyGraph *const Graph) noexcept -> bool
+    {
+        if (Graph != nullptr) {
+            Graph->clear();
+        }
+
+        return ResolveTopLevelStmtList(Unit, Unit.getTopLevelStmtList(),
+                                       /*IsWholeUnit=*/true, Diag, Graph);
+    }
+
+    auto
+    ResolveChangedNames(const Parse::ParseUnit &Unit,
+                        DependencyGraph &Graph,
+                        DiagnosticConsumer &Diag) noexcept
+        -> std::vector<AST::Stmt *>
+    {
+        const auto StmtList = Unit.getTopLevelStmtList();
+        const auto StmtSet =
+            std::unordered_set<const AST::Stmt *>(StmtList.begin(),
+                                                  StmtList.end());
+
+        // Names declared by statements that are gone, or that are new, may
+        // now resolve to something else.
+
+        auto ChangedNameList = std::vector<std::string>();
+        auto RemovedList = std::vector<const AST::Stmt *>();
+
+        for (const auto &[Stmt, Node] : Graph.getNodeMap()) {
+            if (!StmtSet.contains(Stmt)) {
+                RemovedList.push_back(Stmt);
+                ChangedNameList.insert(ChangedNameList.end(),
+                                       Node.DeclaredNameList.begin(),
+                                       Node.DeclaredNameList.end());
+            }
+        }
+
+        for (const auto Stmt : RemovedList) {
+            Graph.removeNode(*Stmt);
+        }
+
+        auto ResolveSet = std::unordered_set<const AST::Stmt *>();
+        auto Collector = NameResolver(Unit, Diag, nullptr);
+
+        for (const auto Stmt : StmtList) {
+            if (!Graph.contains(*Stmt)) {
+                ResolveSet.insert(Stmt);
+                Collector.collectDeclaredNames(*Stmt, ChangedNameList);
+            }
+        }
+
+        for (const auto Stmt : Graph.collectDependents(ChangedNameList)) {
+            ResolveSet.insert(Stmt);
+        }
+
+        auto ResolveList = std::vector<AST::Stmt *>();
+        for (const auto Stmt : StmtList) {
+            if (ResolveSet.contains(Stmt)) {
+                ResolveList.push_back(Stmt);
+            }
+        }
+
+        ResolveTopLevelStmtList(Unit, ResolveList, /*IsWholeUnit=*/false,
+                                Diag, &Graph);
+        return ResolveList;
+    }
+}
@@ -1,16 +1,69 @@
 /*
  * Sema/SymbolTable.cpp
+ * © suhas pai
  */
 
+#include <cassert>
 #include "Sema/SymbolTable.h"
 
 namespace Sema {
-    SymbolTable::SymbolTable() noexcept : ScopeList() {
-        // Add global scope
-        addScope(new Scope());
+    void SymbolTable::pushScope() noexcept {
+        this->ScopeStartList.push_back(this->UndoLog.size());
     }
 
-    auto SymbolTable::addScope(Scope *const Scope) noexcept -> bool {
-        return ScopeList.emplace_back(Scope);
+    void SymbolTable::popScope() noexcept {
+        assert(!this->ScopeStartList.empty() && "No scope to pop");
+
+        const auto Start = this->ScopeStartList.back();
+        this->ScopeStartList.pop_back();
+
+        // Undo in reverse, in case a name was declared more than once.
+        while (this->UndoLog.size() != Start) {
+            const auto &Undo = this->UndoLog.back();
+            if (Undo.Shadowed.has_value()) {
+                this->Map.find(Undo.Name)->second = Undo.Shadowed.value();
+            } else {
+                this->Map.erase(Undo.Name);
+            }
+
+            this->UndoLog.pop_back();
+        }
+    }
+
+    auto
+    SymbolTable::addDecl(const std::string_view Name, AST::Stmt &Decl) noexcept
+        -> AST::Stmt *
+    {
+        assert(!this->ScopeStartList.empty() && "No scope to add to");
+
+        const auto NewEntry = Entry {
+            .Decl = &Decl,
+            .Depth = this->getDepth()
+        };
+
+        const auto [Iter, Inserted] = this->Map.try_emplace(Name, NewEntry);
+        if (Inserted) {
+            this->UndoLog.push_back({ .Name = Name, .Shadowed = std::nullopt });
+            return nullptr;
+        }
+
+        if (Iter->second.Depth == NewEntry.Depth) {
+            return Iter->second.Decl;
+        }
+
+        this->UndoLog.push_back({ .Name = Name, .Shadowed = Iter->second });
+        Iter->second = NewEntry;
+
+        return nullptr;
+    }
+
+    auto SymbolTable::lookup(const std::string_view Name) const noexcept
+        -> AST::Stmt *
+    {
+        if (const auto Iter = this->Map.find(Name); Iter != this->Map.end()) {
+            return Iter->second.Decl;
+        }
+
+        return nullptr;
     }
 }
@@ -0,0 +1,262 @@
+/*
+ * Sema/Types/Context.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <format>
+
+#include "llvm/Support/Casting.h"
+#include "Sema/Types/Context.h"
+
+namespace Sema {
+    [[nodiscard]] static constexpr auto
+    HashCombine(const size_t Seed, const size_t Hash) noexcept -> size_t {
+        return Seed ^ (Hash + 0x9e3779b97f4a7c15 + (Seed << 6) + (Seed >> 2));
+    }
+
+    auto
+    TypeContext::KeyHash::operator()(const PointerKey &Key) const noexcept
+        -> size_t
+    {
+        return HashCombine(std::hash<Type *>()(Key.PointeeType), Key.QualBits);
+    }
+
+    auto
+    TypeContext::KeyHash::operator()(const ArrayKey &Key) const noexcept
+        -> size_t
+    {
+        return HashCombine(std::hash<Type *>()(Key.ElementType),
+                           std::hash<std::optional<uint64_t>>()(Key.Length));
+    }
+
+    auto
+    TypeContext::KeyHash::operator()(const FunctionKey &Key) const noexcept
+        -> size_t
+    {
+        auto Result = std::hash<QualifiedType *>()(Key.ReturnType);
+        for (const auto Param : Key.ParamList) {
+            Result = HashCombine(Result, std::hash<QualifiedType *>()(Param));
+        }
+
+        return Result;
+    }
+
+    auto
+    TypeContext::KeyHash::operator()(
+        const std::vector<Type *> &Key) const noexcept -> size_t
+    {
+        auto Result = Key.size();
+        for (const auto Member : Key) {
+            Result = HashCombine(Result, std::hash<Type *>()(Member));
+        }
+
+        return Result;
+    }
+
+    auto
+    TypeContext::getQualifiedType(Type &Ty, const TypeQualifiers Quals) noexcept
+        -> QualifiedType &
+    {
+        return this->QualifiedTable.getQualifiedTypeOrInsert(&Ty, Quals);
+    }
+
+    auto
+    TypeContext::getPointerType(Type &PointeeType,
+                                const PointerBaseTypeQualifiers Quals) noexcept
+        -> PointerType &
+    {
+        const auto Key = PointerKey {
+            .PointeeType = &PointeeType,
+            .QualBits = Quals.getBits()
+        };
+
+        if (const auto Iter = this->PointerMap.find(Key);
+            Iter != this->PointerMap.end())
+        {
+            return *Iter->second;
+        }
+
+        const auto Name =
+            std::format("*{}{}{}{}",
+                        Quals.isMutable ? "mut " : "",
+                        Quals.isVolatile ? "volatile " : "",
+                        Quals.isUnaliased ? "unaliased " : "",
+                        PointeeType.getName());
+
+        auto &Result =
+            this->create<PointerType>(&PointeeType,
+                                      Quals,
+                                      this->Allocator.copy(Name));
+
+        this->PointerMap.emplace(Key, &Result);
+        return Result;
+    }
+
+    auto
+    TypeContext::getArrayType(Type &ElementType,
+                              const std::optional<uint64_t> Length) noexcept
+        -> ArrayType &
+    {
+        const auto Key = ArrayKey {
+            .ElementType = &ElementType,
+            .Length = Length
+        };
+
+        if (const auto Iter = this->ArrayMap.find(Key);
+            Iter != this->ArrayMap.end())
+        {
+            return *Iter->second;
+        }
+
+        const auto Name =
+            Length.has_value() ?
+                std::format("[{}]{}", Length.value(), ElementType.getName()) :
+                std::format("[]{}", ElementType.getName());
+
+        auto &Result =
+            this->create<ArrayType>(&ElementType,
+                                    Length,
+                                    this->Allocator.copy(Name));
+
+        this->ArrayMap.emplace(Key, &Result);
+        return Result;
+    }
+
+    auto TypeContext::getOptionalType(Type &BaseType) noexcept
+        -> OptionalType &
+    {
+        if (const auto Iter = this->OptionalMap.find(&BaseType);
+            Iter != this->OptionalMap.end())
+        {
+            return *Iter->second;
+        }
+
+        const auto Name = std::format("?{}", BaseType.getName());
+        auto &Result =
+            this->create<OptionalType>(&BaseType, this->Allocator.copy(Name));
+
+        this->OptionalMap.emplace(&BaseType, &Result);
+        return Result;
+    }
+
+    auto
+    TypeContext::getFunctionPrototype(
+        QualifiedType &ReturnType,
+        const std::span<QualifiedType *const> ParamList) noexcept
+            -> FunctionPrototype &
+    {
+        auto Key = FunctionKey {
+            .ReturnType = &ReturnType,
+            .ParamList =
+                std::vector<QualifiedType *>(ParamList.begin(),
+                                             ParamList.end())
+        };
+
+        if (const auto Iter = this->FunctionMap.find(Key);
+            Iter != this->FunctionMap.end())
+        {
+            return *Iter->second;
+        }
+
+        auto Name = std::string("func(");
+        for (auto I = size_t(); I != ParamList.size(); I++) {
+            if (I != 0) {
+                Name.append(", ");
+            }
+
+            Name.append(ParamList[I]->getType()->getName());
+        }
+
+        Name.append(") -> ");
+        Name.append(ReturnType.getType()->getName());
+
+        auto &Result =
+            this->create<FunctionPrototype>(&ReturnType,
+                                            this->Allocator.copy(ParamList),
+                                            this->Allocator.copy(Name));
+
+        this->FunctionMap.emplace(std::move(Key), &Result);
+        return Result;
+    }
+
+    auto
+    TypeContext::getUnionOfType(const std::span<Type *const> MemberList)
+        noexcept -> Type &
+    {
+        assert(!MemberList.empty() && "A union needs at least one member");
+
+        auto FlatList = std::vector<Type *>();
+        const auto AddMember = [&](Type *const Member) noexcept {
+            if (std::find(FlatList.begin(), FlatList.end(), Member) ==
+                    FlatList.end())
+            {
+                FlatList.push_back(Member);
+            }
+        };
+
+        for (const auto Member : MemberList) {
+            if (const auto UnionOf = llvm::dyn_cast<UnionOfType>(Member)) {
+                for (const auto InnerMember : UnionOf->getMemberList()) {
+                    AddMember(InnerMember);
+                }
+            } else {
+                AddMember(Member);
+            }
+        }
+
+        if (FlatList.size() == 1) {
+            return *FlatList.front();
+        }
+
+        // Types have no order of their own, so the key orders members by
+        // address. The union keeps the order it was first written in, which
+        // is the order used for its name.
+
+        auto Key = FlatList;
+        std::sort(Key.begin(), Key.end());
+
+        if (const auto Iter = this->UnionOfMap.find(Key);
+            Iter != this->UnionOfMap.end())
+        {
+            return *Iter->second;
+        }
+
+        auto Name = std::string();
+        for (const auto Member : FlatList) {
+            if (!Name.empty()) {
+                Name.append(" or ");
+            }
+
+            Name.append(Member->getName());
+        }
+
+        auto &Result =
+            this->create<UnionOfType>(this->Allocator.copy(FlatList),
+                                      this->Allocator.copy(Name));
+
+        this->UnionOfMap.emplace(std::move(Key), &Result);
+        return Result;
+    }
+
+    auto TypeContext::createStructType(const std::string_view Name) noexcept
+        -> StructType &
+    {
+        return this->create<StructType>(this->Allocator.copy(Name));
+    }
+
+    auto
+    TypeContext::completeStructType(
+        StructType &Struct,
+        const std::span<const StructType::Field> FieldList) noexcept
+            -> StructType &
+    {
+        auto FieldCopyList = this->Allocator.copy(FieldList);
+        for (auto &Field : FieldCopyList) {
+            Field.Name = this->Allocator.copy(Field.Name);
+        }
+
+        return Struct.complete(FieldCopyList);
+    }
+}
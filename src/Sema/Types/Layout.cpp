@@ -0,0 +1,254 @@
+/*
+ * Sema/Types/Layout.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Type.h"
+#include "llvm/Support/Casting.h"
+
+#include "Sema/Types/Array.h"
+#include "Sema/Types/Builtin.h"
+#include "Sema/Types/Layout.h"
+#include "Sema/Types/Optional.h"
+#include "Sema/Types/Struct.h"
+#include "Sema/Types/UnionOf.h"
+
+namespace Sema {
+    [[nodiscard]] static constexpr auto
+    AlignTo(const uint64_t Value, const uint64_t Alignment) noexcept
+        -> uint64_t
+    {
+        return (Value + Alignment - 1) / Alignment * Alignment;
+    }
+
+    LayoutContext::LayoutContext(const llvm::DataLayout &DL) noexcept
+    : PointerLayout({
+        .Size = DL.getPointerSize(),
+        .Alignment = DL.getPointerABIAlignment(/*AS=*/0).value()
+      })
+    {
+        // Only the builtin types need LLVM types to be laid out, so they're
+        // laid out here, with a context that doesn't outlive them.
+
+        auto Context = llvm::LLVMContext();
+        const auto AddBuiltin =
+            [&](const BuiltinType &Ty, llvm::Type *const LLVMType) noexcept {
+                this->LayoutMap.emplace(&Ty, LayoutEntry {
+                    .State = LayoutState::Computed,
+                    .Layout = TypeLayout {
+                        .Size = DL.getTypeAllocSize(LLVMType).getFixedValue(),
+                        .Alignment = DL.getABITypeAlign(LLVMType).value()
+                    }
+                });
+            };
+
+        this->LayoutMap.emplace(&BuiltinType::voidType(), LayoutEntry {
+            .State = LayoutState::Computed,
+            .Layout = TypeLayout()
+        });
+
+        AddBuiltin(BuiltinType::u8(), llvm::Type::getInt8Ty(Context));
+        AddBuiltin(BuiltinType::u16(), llvm::Type::getInt16Ty(Context));
+        AddBuiltin(BuiltinType::u32(), llvm::Type::getInt32Ty(Context));
+        AddBuiltin(BuiltinType::u64(), llvm::Type::getInt64Ty(Context));
+        AddBuiltin(BuiltinType::s8(), llvm::Type::getInt8Ty(Context));
+        AddBuiltin(BuiltinType::s16(), llvm::Type::getInt16Ty(Context));
+        AddBuiltin(BuiltinType::s32(), llvm::Type::getInt32Ty(Context));
+        AddBuiltin(BuiltinType::s64(), llvm::Type::getInt64Ty(Context));
+
+        // LLVM has no 8-bit float, so f8 is stored as a byte.
+        AddBuiltin(BuiltinType::f8(), llvm::Type::getInt8Ty(Context));
+        AddBuiltin(BuiltinType::f16(), llvm::Type::getHalfTy(Context));
+        AddBuiltin(BuiltinType::f32(), llvm::Type::getFloatTy(Context));
+        AddBuiltin(BuiltinType::f64(), llvm::Type::getDoubleTy(Context));
+        AddBuiltin(BuiltinType::boolType(), llvm::Type::getInt1Ty(Context));
+    }
+
+    auto
+    LayoutContext::computeStructLayout(const StructType &Struct) noexcept
+        -> std::optional<TypeLayout>
+    {
+        if (!Struct.isComplete()) {
+            return std::nullopt;
+        }
+
+        const auto FieldList = Struct.getFieldList();
+        auto FieldLayoutList = std::vector<const TypeLayout *>();
+
+        FieldLayoutList.reserve(FieldList.size());
+        for (const auto &Field : FieldList) {
+            const auto Layout = this->getLayout(*Field.Type->getType());
+            if (Layout == nullptr) {
+                return std::nullopt;
+            }
+
+            FieldLayoutList.push_back(Layout);
+        }
+
+        auto Result = TypeLayout();
+
+        Result.FieldOrder.resize(FieldList.size());
+        std::iota(Result.FieldOrder.begin(),
+                  Result.FieldOrder.end(),
+                  uint32_t());
+
+        // Alignments are powers of two, and sizes are multiples of them, so
+        // placing fields from the most aligned to the least leaves no padding
+        // between them. Fields of equal alignment keep their order.
+
+        if (Struct.reordersFields()) {
+            std::stable_sort(Result.FieldOrder.begin(),
+                             Result.FieldOrder.end(),
+                             [&](const uint32_t Left,
+                                 const uint32_t Right) noexcept
+                             {
+                                 return FieldLayoutList[Left]->Alignment >
+                                        FieldLayoutList[Right]->Alignment;
+                             });
+        }
+
+        Result.FieldOffsetList.resize(FieldList.size());
+        for (const auto Index : Result.FieldOrder) {
+            const auto &Field = *FieldLayoutList[Index];
+            const auto Offset = AlignTo(Result.Size, Field.Alignment);
+
+            Result.FieldOffsetList[Index] = Offset;
+            Result.Size = Offset + Field.Size;
+            Result.Alignment = std::max(Result.Alignment, Field.Alignment);
+        }
+
+        Result.Size = AlignTo(Result.Size, Result.Alignment);
+        return Result;
+    }
+
+    auto LayoutContext::computeLayout(const Type &Ty) noexcept
+        -> std::optional<TypeLayout>
+    {
+        switch (Ty.getKind()) {
+            case TypeKind::Builtin:
+                // Builtin types are laid out when the context is created.
+                __builtin_unreachable();
+            case TypeKind::Pointer:
+            case TypeKind::FunctionPrototype:
+                return this->PointerLayout;
+            case TypeKind::Array: {
+                const auto &Array = llvm::cast<ArrayType>(Ty);
+                if (!Array.getLength().has_value()) {
+                    return std::nullopt;
+                }
+
+                const auto Element =
+                    this->getLayout(*Array.getElementType());
+
+                if (Element == nullptr) {
+                    return std::nullopt;
+                }
+
+                auto Size = uint64_t();
+                if (__builtin_mul_overflow(Element->Size,
+                                           Array.getLength().value(),
+                                           &Size))
+                {
+                    return std::nullopt;
+                }
+
+                return TypeLayout {
+                    .Size = Size,
+                    .Alignment = Element->Alignment
+                };
+            }
+            case TypeKind::Optional: {
+                const auto &Optional = llvm::cast<OptionalType>(Ty);
+                const auto Base = this->getLayout(*Optional.getBaseType());
+
+                if (Base == nullptr) {
+                    return std::nullopt;
+                }
+
+                return TypeLayout {
+                    .Size = AlignTo(Base->Size + 1, Base->Alignment),
+                    .Alignment = Base->Alignment
+                };
+            }
+            case TypeKind::Structure:
+                return this->computeStructLayout(llvm::cast<StructType>(Ty));
+            case TypeKind::UnionOf: {
+                const auto MemberList =
+                    llvm::cast<UnionOfType>(Ty).getMemberList();
+
+                auto Result = TypeLayout();
+                for (const auto Member : MemberList) {
+                    const auto Layout = this->getLayout(*Member);
+                    if (Layout == nullptr) {
+                        return std::nullopt;
+                    }
+
+                    Result.Size = std::max(Result.Size, Layout->Size);
+                    Result.Alignment =
+                        std::max(Result.Alignment, Layout->Alignment);
+                }
+
+                const auto MemberCount = MemberList.size();
+                const auto TagSize =
+                    MemberCount <= (uint64_t(1) << 8) ? 1 :
+                    MemberCount <= (uint64_t(1) << 16) ? 2 : 4;
+
+                Result.Alignment =
+                    std::max(Result.Alignment, uint64_t(TagSize));
+                Result.Size =
+                    AlignTo(AlignTo(Result.Size, TagSize) + TagSize,
+                            Result.Alignment);
+
+                return Result;
+            }
+            case TypeKind::Union:
+            case TypeKind::Enum:
+                // FIXME: Sema doesn't create union or enum types yet.
+                return std::nullopt;
+        }
+
+        __builtin_unreachable();
+    }
+
+    auto LayoutContext::getLayout(const Type &Ty) noexcept
+        -> const TypeLayout *
+    {
+        const auto [Iter, Inserted] =
+            this->LayoutMap.try_emplace(&Ty, LayoutEntry {
+                .State = LayoutState::Computing
+            });
+
+        auto &Entry = Iter->second;
+        if (!Inserted) {
+            // A type still being laid out is only reached again if it
+            // contains itself.
+            if (Entry.State != LayoutState::Computed) {
+                return nullptr;
+            }
+
+            return &Entry.Layout;
+        }
+
+        // Entries are never moved, so Entry is still valid after laying out
+        // the types Ty contains.
+
+        // Types without a layout aren't kept, as one that contains an
+        // incomplete struct may have a layout once the struct is complete.
+
+        auto Layout = this->computeLayout(Ty);
+        if (!Layout.has_value()) {
+            this->LayoutMap.erase(Iter);
+            return nullptr;
+        }
+
+        Entry.State = LayoutState::Computed;
+        Entry.Layout = std::move(Layout.value());
+
+        return &Entry.Layout;
+    }
+}
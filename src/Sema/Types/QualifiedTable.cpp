@@ -12,11 +12,14 @@ namespace Sema {
         const TypeQualifiers Qual) noexcept
             -> QualifiedType &
     {
-        if (const auto It = Table.find(UnderlyingTy); It != Table.end()) {
+        const auto Key =
+            reinterpret_cast<uintptr_t>(UnderlyingTy) | Qual.getBits();
+
+        if (const auto It = Table.find(Key); It != Table.end()) {
             return It->second;
         }
 
         const auto QualTy = QualifiedType(UnderlyingTy, Qual);
-        return Table.emplace(UnderlyingTy, QualTy).first->second;
+        return Table.emplace(Key, QualTy).first->second;
     }
 }
@@ -11,6 +11,7 @@
 
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 #include "Source/SourceBuffer.h"
 
@@ -18,7 +19,7 @@ namespace ADT {
     auto SourceBuffer::FromFile(const std::string_view Path) noexcept
         -> std::expected<SourceBuffer *, Error>
     {
-        const auto Fd = open(Path.data(), O_RDONLY);
+        const auto Fd = open(Path.data(), O_RDONLY | O_CLOEXEC);
         if (Fd == -1) {
             return std::unexpected<Error>({
                 Error::Kind::FailedToOpenFile,
@@ -28,14 +29,35 @@ namespace ADT {
 
         struct stat Stat;
         if (fstat(Fd, &Stat) == -1) {
+            close(Fd);
             return std::unexpected<Error>({
                 Error::Kind::FailedToStatFile,
                 strerror(errno)
             });
         }
 
-        const auto Map =
-            mmap(nullptr, Stat.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+        const auto Result =
+            FromFileDescriptor(Fd,
+                               static_cast<size_t>(Stat.st_size),
+                               /*Populate=*/false);
+
+        close(Fd);
+        return Result;
+    }
+
+    auto
+    SourceBuffer::FromFileDescriptor(const int Fd,
+                                     const size_t Size,
+                                     const bool Populate) noexcept
+        -> std::expected<SourceBuffer *, Error>
+    {
+        // Empty files can't be mapped.
+        if (Size == 0) {
+            return FromUnownedMemory("", 0);
+        }
+
+        const auto Flags = MAP_PRIVATE | (Populate ? MAP_POPULATE : 0);
+        const auto Map = mmap(nullptr, Size, PROT_READ, Flags, Fd, 0);
 
         if (Map == MAP_FAILED) {
             return std::unexpected<Error>({
@@ -44,7 +66,24 @@ namespace ADT {
             });
         }
 
-        return new SourceBuffer(Map, Stat.st_size, DestroyMapKind::Mapped);
+        // The lexer reads the file once, front to back. Without Populate,
+        // start reading the file in now, while the caller gets ready to lex.
+        madvise(Map, Size, MADV_SEQUENTIAL);
+        if (!Populate) {
+            madvise(Map, Size, MADV_WILLNEED);
+        }
+
+        return new SourceBuffer(Map, Size, DestroyMapKind::Mapped);
+    }
+
+    auto
+    SourceBuffer::FromUnownedMemory(const void *const Base,
+                                    const size_t Size) noexcept
+        -> SourceBuffer *
+    {
+        return new SourceBuffer(const_cast<void *>(Base),
+                                Size,
+                                DestroyMapKind::Normal);
     }
 
     auto SourceBuffer::FromAlloc(void *const Base, const size_t Size) noexcept
@@ -0,0 +1,261 @@
+/*
+ * Source/SourceManager.cpp
+ * © suhas pai
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include <errno.h>
+#include <fcntl.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ADT/Parallel.h"
+#include "Source/SourceManager.h"
+
+namespace ADT {
+    struct PendingFile {
+        int Fd = -1;
+        size_t Size = 0;
+
+        // Where in the arena the file is read to, if it is read to one.
+        std::optional<size_t> ArenaOffset;
+        std::expected<SourceBuffer *, SourceBuffer::Error> Result;
+    };
+
+    static void
+    OpenFile(const std::string_view Path, PendingFile &File) noexcept {
+        // Path may not be null-terminated.
+        const auto PathString = std::string(Path);
+
+        File.Fd = open(PathString.c_str(), O_RDONLY | O_CLOEXEC);
+        if (File.Fd == -1) {
+            File.Result = std::unexpected<SourceBuffer::Error>({
+                SourceBuffer::Error::Kind::FailedToOpenFile,
+                strerror(errno)
+            });
+
+            return;
+        }
+
+        struct stat Stat;
+        if (fstat(File.Fd, &Stat) == -1) {
+            File.Result = std::unexpected<SourceBuffer::Error>({
+                SourceBuffer::Error::Kind::FailedToStatFile,
+                strerror(errno)
+            });
+
+            close(File.Fd);
+            File.Fd = -1;
+
+            return;
+        }
+
+        File.Size = static_cast<size_t>(Stat.st_size);
+    }
+
+    static void ReadFile(PendingFile &File, char *const Arena) noexcept {
+        const auto Begin = Arena + File.ArenaOffset.value();
+        for (auto Offset = size_t(); Offset != File.Size;) {
+            const auto Result =
+                pread(File.Fd,
+                      Begin + Offset,
+                      File.Size - Offset,
+                      static_cast<off_t>(Offset));
+
+            if (Result == -1 && errno == EINTR) {
+                continue;
+            }
+
+            if (Result <= 0) {
+                File.Result = std::unexpected<SourceBuffer::Error>({
+                    SourceBuffer::Error::Kind::FailedToReadFile,
+                    Result == 0 ? "File shrank while reading" : strerror(errno)
+                });
+
+                return;
+            }
+
+            Offset += static_cast<size_t>(Result);
+        }
+
+        Begin[File.Size] = '\0';
+        File.Result = SourceBuffer::FromUnownedMemory(Begin, File.Size);
+    }
+
+    auto
+    SourceManager::loadFiles(const std::span<const std::string_view> PathList,
+                             const SourceLoadOptions Options) noexcept
+        -> std::vector<LoadResult>
+    {
+        auto FileList = std::vector<PendingFile>(PathList.size());
+        ForEachInParallel(PathList.size(), [&](const size_t I) noexcept {
+            OpenFile(PathList[I], FileList[I]);
+        });
+
+        // Now that the sizes are known, give every small file its place in
+        // one arena. Each file is followed by a null character.
+
+        auto ArenaSize = size_t();
+        if (Options.ReadSmallFilesIntoArena) {
+            for (auto &File : FileList) {
+                if (File.Fd != -1 && File.Size <= SmallFileLimit) {
+                    File.ArenaOffset = ArenaSize;
+                    ArenaSize += File.Size + 1;
+                }
+            }
+        }
+
+        const auto Arena = ArenaSize != 0 ? new char[ArenaSize] : nullptr;
+        if (Arena != nullptr) {
+            this->ArenaList.emplace_back(Arena);
+        }
+
+        ForEachInParallel(FileList.size(), [&](const size_t I) noexcept {
+            auto &File = FileList[I];
+            if (File.Fd == -1) {
+                return;
+            }
+
+            if (File.ArenaOffset.has_value()) {
+                ReadFile(File, Arena);
+            } else {
+                File.Result =
+                    SourceBuffer::FromFileDescriptor(File.Fd,
+                                                     File.Size,
+                                                     /*Populate=*/true);
+            }
+
+            close(File.Fd);
+        });
+
+        auto ResultList = std::vector<LoadResult>();
+        ResultList.reserve(FileList.size());
+
+        for (auto I = size_t(); I != FileList.size(); I++) {
+            const auto &Result = FileList[I].Result;
+            if (!Result.has_value()) {
+                ResultList.emplace_back(std::unexpected(Result.error()));
+                continue;
+            }
+
+            ResultList.emplace_back(
+                this->addBuffer(PathList[I], Result.value()));
+        }
+
+        return ResultList;
+    }
+
+    auto SourceManager::loadFile(const std::string_view Path) noexcept
+        -> LoadResult
+    {
+        // FromFile() needs a null-terminated path.
+        const auto Result = SourceBuffer::FromFile(std::string(Path));
+        if (!Result.has_value()) {
+            return std::unexpected(Result.error());
+        }
+
+        return this->addBuffer(Path, Result.value());
+    }
+
+    auto
+    SourceManager::addBuffer(const std::string_view Path,
+                             SourceBuffer *const Buffer) noexcept
+        -> LoadResult
+    {
+        // The file's end gets an offset too, for the end-of-file token.
+        const auto Size = Buffer->text().size();
+        if (Size >= UINT32_MAX - this->NextOffset) {
+            delete Buffer;
+            return std::unexpected<SourceBuffer::Error>({
+                SourceBuffer::Error::Kind::FailedToAssignLocations,
+                "Too much source has been loaded"
+            });
+        }
+
+        const auto BaseOffset = this->NextOffset;
+        this->NextOffset += static_cast<uint32_t>(Size) + 1;
+
+        this->FileList.emplace_back(new SourceFile {
+            .Path = std::string(Path),
+            .Buffer = Buffer,
+            .BaseOffset = BaseOffset,
+            .LineStartList = {},
+        });
+
+        return this->FileList.back().get();
+    }
+
+    auto SourceManager::getFile(const GlobalSourceLocation Loc) const noexcept
+        -> const SourceFile *
+    {
+        if (!Loc.isValid() || Loc.Offset >= this->NextOffset) {
+            return nullptr;
+        }
+
+        // Find the last file starting at or before Loc.
+        const auto Iter =
+            std::upper_bound(this->FileList.begin(),
+                             this->FileList.end(),
+                             Loc.Offset,
+                             [](const uint32_t Offset,
+                                const std::unique_ptr<SourceFile> &File)
+                             {
+                                return Offset < File->BaseOffset;
+                             });
+
+        return std::prev(Iter)->get();
+    }
+
+    auto SourceManager::resolve(const GlobalSourceLocation Loc) const noexcept
+        -> std::optional<ResolvedSourceLocation>
+    {
+        const auto File = this->getFile(Loc);
+        if (File == nullptr) {
+            return std::nullopt;
+        }
+
+        auto &LineStartList = File->LineStartList;
+        if (LineStartList.empty()) {
+            const auto Text = File->Buffer->text();
+
+            LineStartList.push_back(0);
+            for (auto Pos = Text.find('\n');
+                 Pos != std::string_view::npos;
+                 Pos = Text.find('\n', Pos + 1))
+            {
+                LineStartList.push_back(static_cast<uint32_t>(Pos + 1));
+            }
+        }
+
+        const auto Index = Loc.Offset - File->BaseOffset;
+        const auto LineIter =
+            std::prev(std::upper_bound(LineStartList.begin(),
+                                       LineStartList.end(),
+                                       Index));
+
+        const auto Row =
+            static_cast<uint32_t>(LineIter - LineStartList.begin());
+        const auto Column = Index - *LineIter;
+
+        return ResolvedSourceLocation {
+            .File = File,
+            .Loc = SourceLocation {
+                .Index = Index,
+                .Row = std::min<uint32_t>(Row, SourceLocation::RowLimit),
+                .Column = static_cast<uint16_t>(
+                    std::min<uint32_t>(Column, SourceLocation::ColumnLimit)),
+            },
+        };
+    }
+
+    SourceManager::~SourceManager() noexcept {
+        for (const auto &File : this->FileList) {
+            delete File->Buffer;
+        }
+    }
+}
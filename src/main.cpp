@@ -56,9 +56,15 @@
 #include "Diag/Consumer.h"
 #include "Lex/TokenBuffer.h"
 
+#include "Misc/CompileServer.h"
+#include "Misc/LanguageServer.h"
 #include "Misc/Repl.h"
 #include "Parse/ParseUnit.h"
+#include "Sema/Comptime/Evaluator.h"
+#include "Sema/Comptime/Fold.h"
+#include "Sema/ResolveNames.h"
 #include "Source/SourceBuffer.h"
+#include "Source/SourceManager.h"
 
 static void PrintDepth(const uint8_t Depth) noexcept {
     for (auto I = uint8_t(); I != Depth; ++I) {
@@ -216,9 +222,9 @@ static void PrintAST(AST::Stmt *const Stmt, const uint8_t Depth) noexcept {
         case AST::NodeKind::BinaryOperation: {
             const auto BinaryExpr = llvm::cast<AST::BinaryOperation>(Stmt);
             const auto Lexeme =
-                Parse::BinaryOperatorToLexemeMap[BinaryExpr->getOperator()];
+                Parse::BinaryOperatorGetLexeme(BinaryExpr->getOperator());
 
-            std::print("BinaryOperation<\"{}\">\n", Lexeme.value());
+            std::print("BinaryOperation<\"{}\">\n", Lexeme);
 
             PrintAST(&BinaryExpr->getLhs(), Depth + 1);
             PrintAST(&BinaryExpr->getRhs(), Depth + 1);
@@ -228,9 +234,9 @@ static void PrintAST(AST::Stmt *const Stmt, const uint8_t Depth) noexcept {
         case AST::NodeKind::UnaryOperation: {
             const auto UnaryExpr = llvm::cast<AST::UnaryOperation>(Stmt);
             const auto Lexeme =
-                Parse::UnaryOperatorToLexemeMap[UnaryExpr->getOperator()];
+                Parse::UnaryOperatorGetLexeme(UnaryExpr->getOperator());
 
-            std::print("UnaryOperation<{}>\n", Lexeme.value());
+            std::print("UnaryOperation<{}>\n", Lexeme);
             PrintAST(&UnaryExpr->getOperand(), Depth + 1);
 
             return;
@@ -244,16 +250,18 @@ static void PrintAST(AST::Stmt *const Stmt, const uint8_t Depth) noexcept {
         case AST::NodeKind::NumberLiteral: {
             const auto IntLit = llvm::cast<AST::NumberLiteral>(Stmt);
             switch (IntLit->getNumber().Success.Kind) {
-                case Parse::NumberKind::UnsignedInteger:
+                case Lex::NumberKind::UnsignedInteger:
                     std::print("NumberLiteral<{}, unsigned>\n",
                                IntLit->getNumber().Success.UInt);
                     return;
-                case Parse::NumberKind::SignedInteger:
+                case Lex::NumberKind::SignedInteger:
                     std::print("NumberLiteral<{}, signed>\n",
                                IntLit->getNumber().Success.SInt);
                     return;
-                case Parse::NumberKind::FloatingPoint:
-                    assert(false && "Floating point literals not supported");
+                case Lex::NumberKind::FloatingPoint:
+                    std::print("NumberLiteral<{}, float>\n",
+                               IntLit->getNumber().Success.Float64);
+                    return;
             }
 
             return;
@@ -782,6 +790,9 @@ struct ArgumentOptions {
     bool PrintAST : 1 = false;
     bool PrintIR : 1 = false;
 
+    // Stop after parsing, without setting up the LLVM backend.
+    bool SyntaxOnly : 1 = false;
+
     uint32_t PrintDepth = 0;
 };
 
@@ -828,6 +839,10 @@ HandlePrompt(const std::string_view &Prompt,
     });
 
     auto Unit = Parse::ParseUnit::Create(TokenBuffer, Diag, Options);
+    if (Sema::ResolveNames(Unit, Diag)) {
+        Sema::Comptime::EvaluateComptimeDecls(Unit, Diag);
+    }
+
     if (Diag.hasMessages()) {
         Diag.print();
     }
@@ -843,10 +858,11 @@ HandlePrompt(const std::string_view &Prompt,
         std::print("\n");
     }
 
-    if (Diag.hasErrors()) {
+    if (Diag.hasErrors() || ArgOptions.SyntaxOnly) {
         return;
     }
 
+    Sema::Comptime::FoldConstants(Unit);
     auto BackendHandlerExp = Backend::LLVM::JITHandler::Create(Diag, Unit);
     if (!BackendHandlerExp.has_value()) {
         return;
@@ -863,8 +879,21 @@ HandlePrompt(const std::string_view &Prompt,
 
 void PrintUsage(const char *const Name) noexcept {
     std::print("Usage: {} [<prompt>] [-h/--help/-u/--usage] [--print-tokens] "
-               "[--print-ast]\n",
+               "[--print-ast] [--print-ir] [-fsyntax-only/--check] [--lsp] "
+               "[--server <socket>] [--connect <socket>]\n",
                Name);
+    std::print("\n"
+               "  --server <socket>   Run requests sent with --connect. Each "
+               "request runs in\n"
+               "                      a process forked from the server, so "
+               "only process\n"
+               "                      startup and LLVM's target setup are "
+               "saved. Pass\n"
+               "                      managers, the JIT and caches are still "
+               "set up per\n"
+               "                      request.\n"
+               "  --connect <socket>  Send the remaining arguments to a "
+               "server.\n");
 }
 
 void HandleReplOption(const ArgumentOptions ArgOptions) {
@@ -875,16 +904,25 @@ void HandleReplOption(const ArgumentOptions ArgOptions) {
                          });
 }
 
-void
+auto
 HandleFileOptions(const ArgumentOptions ArgOptions,
-                  const std::span<std::string_view> FilePaths) noexcept
+                  const std::span<std::string_view> FilePaths) noexcept -> int
 {
-    for (const auto Path : FilePaths) {
-        auto Diag = SourceFileDiagnosticConsumer(Path);
-        const auto SrcBufferOpt = ADT::SourceBuffer::FromFile(Path);
+    auto SrcManager = ADT::SourceManager();
+    auto Diag = SourceManagerDiagnosticConsumer(SrcManager);
+
+    // Load every file up front, so that reading them overlaps.
+    const auto LoadResultList =
+        SrcManager.loadFiles(FilePaths, {
+            .ReadSmallFilesIntoArena = true,
+        });
 
-        if (!SrcBufferOpt.has_value()) {
-            const auto Error = SrcBufferOpt.error();
+    for (auto I = size_t(); I != FilePaths.size(); I++) {
+        const auto Path = FilePaths[I];
+        const auto &SrcFileOpt = LoadResultList[I];
+
+        if (!SrcFileOpt.has_value()) {
+            const auto Error = SrcFileOpt.error();
             switch (Error.Kind) {
                 case ADT::SourceBuffer::Error::Kind::FailedToOpenFile:
                     std::print(stderr,
@@ -904,11 +942,32 @@ HandleFileOptions(const ArgumentOptions ArgOptions,
                                Path,
                                Error.Reason);
                     exit(1);
+                case ADT::SourceBuffer::Error::Kind::FailedToReadFile:
+                    std::print(stderr,
+                               "Failed to read file: {}, reason: {}\n",
+                               Path,
+                               Error.Reason);
+                    exit(1);
+                case ADT::SourceBuffer::Error::Kind::FailedToAssignLocations:
+                    std::print(stderr,
+                               "Failed to load file: {}, reason: {}\n",
+                               Path,
+                               Error.Reason);
+                    exit(1);
             }
         }
 
-        const auto SrcBuffer = SrcBufferOpt.value();
-        const auto TokenBuffer = Lex::TokenBuffer::Create(*SrcBuffer, Diag);
+        const auto &SrcFile = *SrcFileOpt.value();
+        const auto ErrorCount = Diag.getErrorCount();
+
+        auto FileDiag = Diag.forFile(SrcFile);
+        const auto TokenBuffer =
+            Lex::TokenBuffer::Create(*SrcFile.Buffer, FileDiag);
+
+        if (!TokenBuffer.has_value()) {
+            Diag.print();
+            continue;
+        }
 
         if (ArgOptions.PrintTokens) {
             auto TokenList = TokenBuffer->getTokenList();
@@ -923,24 +982,74 @@ HandleFileOptions(const ArgumentOptions ArgOptions,
 
         const auto Options = Parse::ParseOptions();
 
-        auto Unit = Parse::ParseUnit::Create(*TokenBuffer, Diag, Options);
-        auto BackendHandler = Backend::LLVM::Handler(Diag);
-
+        auto Unit = Parse::ParseUnit::Create(*TokenBuffer, FileDiag, Options);
         if (ArgOptions.PrintAST) {
             for (const auto &[Name, Decl] : Unit.getTopLevelDeclList()) {
                 PrintAST(Decl, /*Depth=*/ArgOptions.PrintDepth);
             }
         }
 
+        auto Resolved = Sema::ResolveNames(Unit, FileDiag);
+        if (Resolved) {
+            Resolved = Sema::Comptime::EvaluateComptimeDecls(Unit, FileDiag);
+        }
+
+        Diag.print();
+
+        // Code is only generated for units without errors. Sema can succeed
+        // on a unit the parser had errors in, which is missing the code that
+        // failed to parse.
+
+        if (ArgOptions.SyntaxOnly || !Resolved ||
+            Diag.getErrorCount() != ErrorCount)
+        {
+            continue;
+        }
+
+        // Setting up the backend is costly, so only do it when there's code
+        // to generate.
+        if (!ArgOptions.PrintIR) {
+            continue;
+        }
+
+        Sema::Comptime::FoldConstants(Unit);
+        auto BackendHandler = Backend::LLVM::Handler(FileDiag);
+
         // Context.visitDecls(Diag, AST::Context::VisitOptions());
         // BackendHandler.evaluate(Diag);
-        if (ArgOptions.PrintIR) {
-            BackendHandler.getModule().print(llvm::outs(), nullptr);
+        BackendHandler.getModule().print(llvm::outs(), nullptr);
+        Diag.print();
+    }
+
+    return Diag.hasErrors() ? 1 : 0;
+}
+
+auto
+RunCompileClient(const std::string_view SocketPath,
+                 const int Argc,
+                 const char *const Argv[]) noexcept -> int
+{
+    // Forward every argument except "--connect <socket>".
+    auto ArgList = std::vector<const char *>();
+    for (auto I = 0; I != Argc; I++) {
+        if (std::string_view(Argv[I]) == "--connect") {
+            I++;
+            continue;
         }
+
+        ArgList.push_back(Argv[I]);
     }
+
+    return Interface::RunCompileClient(SocketPath,
+                                       static_cast<int>(ArgList.size()),
+                                       ArgList.data());
 }
 
-int main(const int Argc, const char *const Argv[]) {
+int
+HandleArguments(const int Argc,
+                const char *const Argv[],
+                const bool IsServerRequest) noexcept
+{
     auto FilePaths = std::vector<std::string_view>();
 
     auto Options = ArgumentOptions();
@@ -973,6 +1082,45 @@ int main(const int Argc, const char *const Argv[]) {
             continue;
         }
 
+        if (Arg == "-fsyntax-only" || Arg == "--check") {
+            Options.SyntaxOnly = true;
+            continue;
+        }
+
+        if (Arg == "--lsp") {
+            return Interface::RunLanguageServer();
+        }
+
+        if (Arg == "--server" || Arg == "--connect") {
+            if (IsServerRequest) {
+                std::print(stderr,
+                           "Option {} can't be sent to a server\n",
+                           Arg);
+                return 1;
+            }
+
+            const auto SocketPath = Lexer.consume();
+            if (SocketPath == nullptr) {
+                std::print(stderr, "Expected a socket path after {}\n", Arg);
+                return 1;
+            }
+
+            if (Arg == "--connect") {
+                return RunCompileClient(SocketPath, Argc, Argv);
+            }
+
+            // Only the native target is set up before forking. Each request
+            // still builds its own handler, pass managers and JIT.
+            Backend::LLVM::Handler::initializeLLVM();
+            return Interface::RunCompileServer(
+                SocketPath,
+                [](const int Argc, const char *const Argv[]) noexcept {
+                    return HandleArguments(Argc,
+                                           Argv,
+                                           /*IsServerRequest=*/true);
+                });
+        }
+
         std::print(stderr, "Unrecognized option: {}\n", Arg);
         return 1;
     }
@@ -986,6 +1134,9 @@ int main(const int Argc, const char *const Argv[]) {
         return 0;
     }
 
-    HandleFileOptions(Options, FilePaths);
-    return 0;
+    return HandleFileOptions(Options, FilePaths);
+}
+
+int main(const int Argc, const char *const Argv[]) {
+    return HandleArguments(Argc, Argv, /*IsServerRequest=*/false);
 }